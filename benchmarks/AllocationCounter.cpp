@@ -0,0 +1,51 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<bool> countingEnabled{false};
+std::atomic<quint64> allocationCount{0};
+std::atomic<quint64> allocatedBytes{0};
+}  // namespace
+
+namespace ed {
+namespace bench {
+
+void EAllocationCounter::setEnabled(bool enabled) {
+    countingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool EAllocationCounter::isEnabled() {
+    return countingEnabled.load(std::memory_order_relaxed);
+}
+
+EAllocationCounter::Snapshot EAllocationCounter::snapshot() {
+    return {allocationCount.load(std::memory_order_relaxed), allocatedBytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace bench
+}  // namespace ed
+
+// The array and nothrow forms of the standard library forward to these
+void* operator new(std::size_t size) {
+    if (countingEnabled.load(std::memory_order_relaxed)) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void* ptr = std::malloc(size ? size : 1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
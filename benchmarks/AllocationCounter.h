@@ -0,0 +1,35 @@
+#ifndef ED_DOCKMENU_ALLOCATION_COUNTER_H
+#define ED_DOCKMENU_ALLOCATION_COUNTER_H
+
+#include <QtGlobal>
+
+namespace ed {
+namespace bench {
+
+/**
+ * Counts calls of the global operator new while enabled. The benchmark
+ * executable replaces operator new, so allocations made by Qt and by the
+ * library are counted as well. Memory that Qt allocates with malloc directly,
+ * like the raster data of a QPixmap, is not included.
+ */
+class EAllocationCounter {
+public:
+    struct Snapshot {
+        quint64 allocations = 0;
+        quint64 bytes = 0;
+
+        Snapshot operator-(const Snapshot& other) const {
+            return {allocations - other.allocations, bytes - other.bytes};
+        }
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static Snapshot snapshot();
+};
+
+}  // namespace bench
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_ALLOCATION_COUNTER_H
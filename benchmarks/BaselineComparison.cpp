@@ -0,0 +1,124 @@
+#include "BaselineComparison.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <algorithm>
+#include <cmath>
+
+namespace ed {
+namespace bench {
+
+double EMetricComparison::change() const {
+    return baselineMedian != 0 ? (currentMedian - baselineMedian) / baselineMedian : 0;
+}
+
+QString EMetricComparison::verdictName() const {
+    switch (verdict) {
+        case Improved:
+            return "improved";
+        case Regressed:
+            return "REGRESSED";
+        case New:
+            return "new";
+        case Missing:
+            return "missing";
+        default:
+            return "unchanged";
+    }
+}
+
+bool EBaselineComparison::load(const QString& fileName, QString* errorMessage) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (errorMessage) {
+            *errorMessage = QString("Cannot read %1").arg(fileName);
+        }
+        return false;
+    }
+
+    QJsonParseError parseError;
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+        if (errorMessage) {
+            *errorMessage = QString("%1 is no benchmark result: %2").arg(fileName, parseError.errorString());
+        }
+        return false;
+    }
+
+    QJsonObject root = document.object();
+    m_baseline.clear();
+    for (const QJsonValue& metric : root["metrics"].toArray()) {
+        m_baseline.append(EBenchmarkResult::fromJson(metric.toObject()));
+    }
+
+    root.remove("metrics");
+    m_environment = root;
+    return true;
+}
+
+QJsonObject EBaselineComparison::environment() const {
+    return m_environment;
+}
+
+QList<EMetricComparison> EBaselineComparison::compare(const QList<EBenchmarkResult>& results,
+                                                      const Thresholds& thresholds) const {
+    QList<EMetricComparison> comparisons;
+
+    for (const auto& current : results) {
+        EMetricComparison comparison;
+        comparison.name = current.name;
+        comparison.unit = current.unit;
+        comparison.currentMedian = current.median();
+        comparison.verdict = EMetricComparison::New;
+
+        for (const auto& baseline : m_baseline) {
+            if (baseline.name != current.name) {
+                continue;
+            }
+
+            comparison.baselineMedian = baseline.median();
+            comparison.noise = qMax(baseline.medianAbsoluteDeviation(), current.medianAbsoluteDeviation());
+
+            const double delta = comparison.currentMedian - comparison.baselineMedian;
+            bool significant = std::abs(delta) > thresholds.relative * comparison.baselineMedian &&
+                               std::abs(delta) > thresholds.noiseFactor * comparison.noise;
+            if (current.unit == "ms") {
+                significant = significant && std::abs(delta) > thresholds.minimumDeltaMs;
+            }
+
+            if (!significant) {
+                comparison.verdict = EMetricComparison::Unchanged;
+            } else {
+                comparison.verdict = delta > 0 ? EMetricComparison::Regressed : EMetricComparison::Improved;
+            }
+            break;
+        }
+        comparisons.append(comparison);
+    }
+
+    for (const auto& baseline : m_baseline) {
+        auto it = std::find_if(results.begin(), results.end(),
+                               [&baseline](const EBenchmarkResult& result) { return result.name == baseline.name; });
+        if (it == results.end()) {
+            EMetricComparison comparison;
+            comparison.name = baseline.name;
+            comparison.unit = baseline.unit;
+            comparison.baselineMedian = baseline.median();
+            comparison.verdict = EMetricComparison::Missing;
+            comparisons.append(comparison);
+        }
+    }
+
+    return comparisons;
+}
+
+bool EBaselineComparison::hasRegression(const QList<EMetricComparison>& comparisons) {
+    return std::any_of(comparisons.begin(), comparisons.end(), [](const EMetricComparison& comparison) {
+        return comparison.verdict == EMetricComparison::Regressed;
+    });
+}
+
+}  // namespace bench
+}  // namespace ed
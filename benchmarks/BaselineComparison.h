@@ -0,0 +1,70 @@
+#ifndef ED_DOCKMENU_BASELINE_COMPARISON_H
+#define ED_DOCKMENU_BASELINE_COMPARISON_H
+
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+#include "BenchmarkSuite.h"
+
+namespace ed {
+namespace bench {
+
+/**
+ * Result of comparing one metric with the baseline
+ */
+struct EMetricComparison {
+    enum Verdict { Unchanged, Improved, Regressed, New, Missing };
+
+    QString name;
+    QString unit;
+    double baselineMedian = 0;
+    double currentMedian = 0;
+    double noise = 0;  //!< larger MAD of baseline and current samples
+    Verdict verdict = Unchanged;
+
+    /**
+     * Relative change of the median, 0.1 is 10% slower
+     */
+    double change() const;
+    QString verdictName() const;
+};
+
+/**
+ * Compares the results of a run with a JSON document written by an earlier
+ * run of eddockmenu_bench.
+ *
+ * A metric only counts as changed if its median moved by more than the
+ * relative threshold and by more than noiseFactor times the median absolute
+ * deviation of the samples. Timings additionally ignore changes below
+ * minimumDeltaMs, which are mostly timer resolution on small operations.
+ */
+class EBaselineComparison {
+public:
+    struct Thresholds {
+        double relative = 0.10;
+        double noiseFactor = 3.0;
+        double minimumDeltaMs = 0.05;
+    };
+
+    bool load(const QString& fileName, QString* errorMessage = nullptr);
+
+    /**
+     * Describes where the baseline was recorded, e.g. to warn about a
+     * different Qt version or platform
+     */
+    QJsonObject environment() const;
+
+    QList<EMetricComparison> compare(const QList<EBenchmarkResult>& results, const Thresholds& thresholds) const;
+
+    static bool hasRegression(const QList<EMetricComparison>& comparisons);
+
+private:
+    QJsonObject m_environment;
+    QList<EBenchmarkResult> m_baseline;
+};
+
+}  // namespace bench
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_BASELINE_COMPARISON_H
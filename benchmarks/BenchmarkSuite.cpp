@@ -0,0 +1,483 @@
+#include "BenchmarkSuite.h"
+
+#include <ed/dockmenu/InputReplay.h>
+#include <ed/dockmenu/MenuButton.h>
+#include <ed/dockmenu/MenuFloating.h>
+#include <ed/dockmenu/MenuManager.h>
+#include <ed/dockmenu/MenuTitleBar.h>
+#include <ed/dockmenu/PointerSource.h>
+#include <ed/dockmenu/SlidingStacked.h>
+
+#include <QApplication>
+#include <QCursor>
+#include <QDateTime>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QGuiApplication>
+#include <QJsonArray>
+#include <QLabel>
+#include <QMainWindow>
+#include <QMouseEvent>
+#include <QPlainTextEdit>
+#include <QSysInfo>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace ed {
+namespace bench {
+
+namespace {
+const int ToolSwitchCount = 50;
+const int DragMoveCount = 30;
+
+double elapsedMs(const QElapsedTimer& timer) {
+    return timer.nsecsElapsed() / 1.0e6;
+}
+
+void processEvents() {
+    QCoreApplication::processEvents();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+bool waitFor(const std::function<bool()>& condition, int timeoutMs = 2000) {
+    QElapsedTimer timer;
+    timer.start();
+    while (!condition()) {
+        if (timer.elapsed() > timeoutMs) {
+            return false;
+        }
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+    }
+    return true;
+}
+
+void sendMouse(QWidget* target, QEvent::Type type, const QPoint& globalPos, Qt::MouseButton button,
+               Qt::MouseButtons buttons) {
+    // The library reads QCursor::pos() while dragging, so keep it in sync with the event
+    QCursor::setPos(globalPos);
+    EPointerSource::instance().invalidate();
+    QMouseEvent event(type, target->mapFromGlobal(globalPos), globalPos, button, buttons, Qt::NoModifier);
+    QApplication::sendEvent(target, &event);
+}
+
+EMenuTitleBar* visibleTitleBar(EMenuManager* manager) {
+    const auto titleBars = manager->findChildren<EMenuTitleBar*>();
+    for (auto* titleBar : titleBars) {
+        if (titleBar->isVisible()) {
+            return titleBar;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+double EBenchmarkResult::min() const {
+    return samples.isEmpty() ? 0 : *std::min_element(samples.begin(), samples.end());
+}
+
+double EBenchmarkResult::max() const {
+    return samples.isEmpty() ? 0 : *std::max_element(samples.begin(), samples.end());
+}
+
+double EBenchmarkResult::mean() const {
+    if (samples.isEmpty()) {
+        return 0;
+    }
+
+    double sum = 0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    return sum / samples.count();
+}
+
+double EBenchmarkResult::median() const {
+    if (samples.isEmpty()) {
+        return 0;
+    }
+
+    QList<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    int mid = sorted.count() / 2;
+    if (sorted.count() % 2 == 0) {
+        return (sorted[mid - 1] + sorted[mid]) / 2;
+    }
+    return sorted[mid];
+}
+
+double EBenchmarkResult::stddev() const {
+    if (samples.count() < 2) {
+        return 0;
+    }
+
+    double avg = mean();
+    double sum = 0;
+    for (double sample : samples) {
+        sum += (sample - avg) * (sample - avg);
+    }
+    return std::sqrt(sum / (samples.count() - 1));
+}
+
+double EBenchmarkResult::medianAbsoluteDeviation() const {
+    EBenchmarkResult deviations;
+    const double center = median();
+    for (double sample : samples) {
+        deviations.samples.append(std::abs(sample - center));
+    }
+    return deviations.median();
+}
+
+QJsonObject EBenchmarkResult::toJson() const {
+    QJsonArray values;
+    for (double sample : samples) {
+        values.append(sample);
+    }
+
+    QJsonObject object;
+    object["name"] = name;
+    object["unit"] = unit;
+    object["samples"] = values;
+    object["min"] = min();
+    object["max"] = max();
+    object["mean"] = mean();
+    object["median"] = median();
+    object["stddev"] = stddev();
+    return object;
+}
+
+EBenchmarkResult EBenchmarkResult::fromJson(const QJsonObject& object) {
+    EBenchmarkResult result;
+    result.name = object["name"].toString();
+    result.unit = object["unit"].toString();
+    for (const QJsonValue& value : object["samples"].toArray()) {
+        result.samples.append(value.toDouble());
+    }
+    return result;
+}
+
+EBenchmarkSuite::EBenchmarkSuite(int repeat) : m_repeat(qMax(1, repeat)) {
+}
+
+void EBenchmarkSuite::runAll() {
+    for (int menuCount : {10, 100, 1000}) {
+        benchAddMenu(menuCount);
+    }
+    benchStartup();
+    benchToolSwitch();
+    benchFloatRedock();
+    benchTitleBarDrag();
+}
+
+const QList<EBenchmarkResult>& EBenchmarkSuite::results() const {
+    return m_results;
+}
+
+const QStringList& EBenchmarkSuite::failures() const {
+    return m_failures;
+}
+
+QJsonDocument EBenchmarkSuite::toJson() const {
+    QJsonArray metrics;
+    for (const auto& result : m_results) {
+        metrics.append(result.toJson());
+    }
+
+    QJsonObject root;
+    root["library"] = QStringLiteral("eddockmenu");
+    root["version"] = QStringLiteral(ED_DOCKMENU_VERSION_STRING);
+    root["qt"] = QString::fromLatin1(qVersion());
+    root["platform"] = QGuiApplication::platformName();
+    root["cpu"] = QSysInfo::currentCpuArchitecture();
+    root["os"] = QSysInfo::prettyProductName();
+    root["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    root["repeat"] = m_repeat;
+    root["metrics"] = metrics;
+    return QJsonDocument(root);
+}
+
+EBenchmarkSuite::Fixture EBenchmarkSuite::createFixture(int menuCount, bool show) {
+    Fixture fixture;
+    fixture.window = new QMainWindow();
+    fixture.window->resize(1280, 800);
+    fixture.manager = new EMenuManager(MenuDirection::Left, fixture.window);
+
+    for (int index = 0; index < menuCount; ++index) {
+        QString name = QString("Menu %1").arg(index);
+        fixture.manager->addMenu(name, QString(), QString(), name, new QLabel(name));
+    }
+    fixture.manager->setCentralWidget(new QPlainTextEdit("Central Widget"));
+
+    if (show) {
+        fixture.window->show();
+        processEvents();
+    }
+    return fixture;
+}
+
+void EBenchmarkSuite::destroyFixture(Fixture& fixture) {
+    delete fixture.window;
+    fixture.window = nullptr;
+    fixture.manager = nullptr;
+    processEvents();
+}
+
+void EBenchmarkSuite::addSample(const QString& name, const QString& unit, double value) {
+    for (auto& result : m_results) {
+        if (result.name == name) {
+            result.samples.append(value);
+            return;
+        }
+    }
+
+    EBenchmarkResult result;
+    result.name = name;
+    result.unit = unit;
+    result.samples.append(value);
+    m_results.append(result);
+}
+
+void EBenchmarkSuite::addFailure(const QString& message) {
+    qCritical().noquote() << message;
+    m_failures.append(message);
+}
+
+void EBenchmarkSuite::addAllocationSamples(const QString& name, const EAllocationCounter::Snapshot& delta,
+                                           int operations) {
+    if (!EAllocationCounter::isEnabled() || operations <= 0) {
+        return;
+    }
+
+    addSample(name + "/allocations", "count", double(delta.allocations) / operations);
+    addSample(name + "/allocatedBytes", "bytes", double(delta.bytes) / operations);
+}
+
+void EBenchmarkSuite::benchAddMenu(int menuCount) {
+    const QString name = QString("addMenu/%1").arg(menuCount);
+    for (int run = 0; run < m_repeat; ++run) {
+        QMainWindow window;
+        EMenuManager* manager = new EMenuManager(MenuDirection::Left, &window);
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int index = 0; index < menuCount; ++index) {
+            QString menuName = QString("Menu %1").arg(index);
+            manager->addMenu(menuName, QString(), QString(), menuName, new QLabel(menuName));
+        }
+        addSample(name, "ms", elapsedMs(timer));
+    }
+    processEvents();
+}
+
+void EBenchmarkSuite::benchStartup() {
+    const MenuDirection directions[] = {MenuDirection::Left, MenuDirection::Right, MenuDirection::Top,
+                                        MenuDirection::Bottom};
+
+    for (int run = 0; run < m_repeat; ++run) {
+        // One window with four nested managers, like a typical terminal layout
+        QMainWindow window;
+        window.resize(1280, 800);
+
+        QList<EMenuManager*> managers;
+        QWidget* parent = &window;
+        for (MenuDirection direction : directions) {
+            EMenuManager* manager = new EMenuManager(direction, parent);
+            for (int index = 0; index < 10; ++index) {
+                QString name = QString("Menu %1").arg(index);
+                manager->addMenu(name, QString(), QString(), name, new QLabel(name));
+            }
+            if (!managers.isEmpty()) {
+                managers.last()->setCentralWidget(manager);
+            }
+            managers.append(manager);
+            parent = nullptr;
+        }
+        managers.last()->setCentralWidget(new QPlainTextEdit("Central Widget"));
+
+        window.show();
+        processEvents();
+
+        EStartupTimings total;
+        for (EMenuManager* manager : managers) {
+            EStartupTimings timings = manager->startupTimings();
+            total.stylesheetReadNs += timings.stylesheetReadNs;
+            total.stylesheetApplyNs += timings.stylesheetApplyNs;
+            total.constructionNs += timings.constructionNs;
+            total.addMenuNs += timings.addMenuNs;
+            total.defaultSizeNs += timings.defaultSizeNs;
+        }
+
+        addSample("startup/stylesheetRead", "ms", total.stylesheetReadNs / 1.0e6);
+        addSample("startup/stylesheetApply", "ms", total.stylesheetApplyNs / 1.0e6);
+        addSample("startup/construction", "ms", total.constructionNs / 1.0e6);
+        addSample("startup/addMenu", "ms", total.addMenuNs / 1.0e6);
+        addSample("startup/defaultSize", "ms", total.defaultSizeNs / 1.0e6);
+    }
+    processEvents();
+}
+
+void EBenchmarkSuite::benchToolSwitch() {
+    for (int run = 0; run < m_repeat; ++run) {
+        Fixture fixture = createFixture(10, true);
+        const auto buttons = fixture.manager->findChildren<EMenuButton*>();
+        ESlidingStacked* stacked = fixture.manager->findChild<ESlidingStacked*>();
+        if (buttons.count() < 2 || stacked == nullptr) {
+            qWarning() << "toolSwitch: fixture incomplete, skipping";
+            destroyFixture(fixture);
+            return;
+        }
+
+        // Only the work of a switch is of interest here, not the animation length
+        stacked->setSpeed(0);
+
+        bool finished = false;
+        QObject::connect(stacked, &ESlidingStacked::animationFinished, [&finished]() { finished = true; });
+
+        double dispatchTotal = 0;
+        double completeTotal = 0;
+        auto allocationsBefore = EAllocationCounter::snapshot();
+        for (int step = 1; step <= ToolSwitchCount; ++step) {
+            finished = false;
+
+            QElapsedTimer timer;
+            timer.start();
+            buttons[step % buttons.count()]->click();
+            dispatchTotal += elapsedMs(timer);
+
+            waitFor([&finished]() { return finished; });
+            completeTotal += elapsedMs(timer);
+        }
+
+        addSample("toolSwitch/dispatch", "ms", dispatchTotal / ToolSwitchCount);
+        addSample("toolSwitch/complete", "ms", completeTotal / ToolSwitchCount);
+        addAllocationSamples("toolSwitch", EAllocationCounter::snapshot() - allocationsBefore, ToolSwitchCount);
+        destroyFixture(fixture);
+    }
+}
+
+void EBenchmarkSuite::benchFloatRedock() {
+    for (int run = 0; run < m_repeat; ++run) {
+        Fixture fixture = createFixture(10, true);
+
+        auto allocationsBefore = EAllocationCounter::snapshot();
+        QElapsedTimer timer;
+        timer.start();
+        EMenuFloating* floating = new EMenuFloating(fixture.manager);
+        floating->startFloating(QPoint(10, 10), fixture.manager->getMenuSize(), DraggingInactive);
+        processEvents();
+        double floatMs = elapsedMs(timer);
+        addAllocationSamples("floatRedock/float", EAllocationCounter::snapshot() - allocationsBefore);
+
+        allocationsBefore = EAllocationCounter::snapshot();
+        timer.restart();
+        fixture.manager->redockMenu(false);
+        processEvents();
+        double redockMs = elapsedMs(timer);
+        addAllocationSamples("floatRedock/redock", EAllocationCounter::snapshot() - allocationsBefore);
+
+        addSample("floatRedock/float", "ms", floatMs);
+        addSample("floatRedock/redock", "ms", redockMs);
+        addSample("floatRedock/roundTrip", "ms", floatMs + redockMs);
+        destroyFixture(fixture);
+    }
+}
+
+void EBenchmarkSuite::benchTitleBarDrag() {
+    for (int run = 0; run < m_repeat; ++run) {
+        Fixture fixture = createFixture(10, true);
+        EMenuTitleBar* titleBar = visibleTitleBar(fixture.manager);
+        if (titleBar == nullptr) {
+            qWarning() << "titleBarDrag: no visible title bar, skipping";
+            destroyFixture(fixture);
+            return;
+        }
+
+        EDragLatencyReport latency;
+        fixture.manager->setDragLatencyProbeEnabled(true);
+        QObject::connect(fixture.manager, &EMenuManager::dragLatencyReport,
+                         [&latency](const EDragLatencyReport& report) { latency = report; });
+
+        QPoint globalPos = titleBar->mapToGlobal(titleBar->rect().center());
+        sendMouse(titleBar, QEvent::MouseButtonPress, globalPos, Qt::LeftButton, Qt::LeftButton);
+
+        // The first move beyond the start drag distance creates the drag preview
+        auto allocationsBefore = EAllocationCounter::snapshot();
+        QElapsedTimer timer;
+        timer.start();
+        globalPos += QPoint(0, EMenuManager::startDragDistance() + 1);
+        sendMouse(titleBar, QEvent::MouseMove, globalPos, Qt::NoButton, Qt::LeftButton);
+        processEvents();
+        addSample("titleBarDrag/start", "ms", elapsedMs(timer));
+        addAllocationSamples("titleBarDrag/start", EAllocationCounter::snapshot() - allocationsBefore);
+
+        allocationsBefore = EAllocationCounter::snapshot();
+        timer.restart();
+        for (int step = 0; step < DragMoveCount; ++step) {
+            globalPos += QPoint(3, 3);
+            sendMouse(titleBar, QEvent::MouseMove, globalPos, Qt::NoButton, Qt::LeftButton);
+            processEvents();
+        }
+        addSample("titleBarDrag/move", "ms", elapsedMs(timer) / DragMoveCount);
+        addAllocationSamples("titleBarDrag/move", EAllocationCounter::snapshot() - allocationsBefore, DragMoveCount);
+
+        allocationsBefore = EAllocationCounter::snapshot();
+        timer.restart();
+        sendMouse(titleBar, QEvent::MouseButtonRelease, globalPos, Qt::LeftButton, Qt::NoButton);
+        processEvents();
+        addSample("titleBarDrag/finish", "ms", elapsedMs(timer));
+        addAllocationSamples("titleBarDrag/finish", EAllocationCounter::snapshot() - allocationsBefore);
+        if (latency.moveLatency.count == 0) {
+            addFailure("titleBarDrag/inputToMove: no move latency recorded, the mouse moves did not move the preview");
+        } else {
+            addSample("titleBarDrag/inputToMove", "ms", latency.moveLatency.avgMs());
+        }
+
+        // Releasing outside of the manager leaves the menu floating
+        fixture.manager->redockMenu(false);
+        processEvents();
+        destroyFixture(fixture);
+    }
+}
+
+void EBenchmarkSuite::benchReplay(const QString& fileName, double speed) {
+    const QString name = QString("replay/%1").arg(QFileInfo(fileName).completeBaseName());
+    for (int run = 0; run < m_repeat; ++run) {
+        Fixture fixture = createFixture(10, true);
+
+        EInputReplay replay(fixture.manager);
+        if (!replay.load(fileName)) {
+            qWarning() << "replay: cannot load" << fileName;
+            destroyFixture(fixture);
+            return;
+        }
+
+        EDragLatencyReport latency;
+        fixture.manager->setDragLatencyProbeEnabled(true);
+        QObject::connect(fixture.manager, &EMenuManager::dragLatencyReport,
+                         [&latency](const EDragLatencyReport& report) { latency = report; });
+
+        bool finished = false;
+        QObject::connect(&replay, &EInputReplay::replayFinished, [&finished]() { finished = true; });
+
+        auto allocationsBefore = EAllocationCounter::snapshot();
+        QElapsedTimer timer;
+        timer.start();
+        replay.replay(speed);
+        int timeoutMs = replay.events().isEmpty() ? 0 : int(replay.events().last().timeMs / qMax(0.01, speed));
+        waitFor([&finished]() { return finished; }, timeoutMs + 5000);
+        processEvents();
+        addSample(name + "/wall", "ms", elapsedMs(timer));
+        addSample(name + "/inputToMove", "ms", latency.moveLatency.avgMs());
+        addAllocationSamples(name, EAllocationCounter::snapshot() - allocationsBefore);
+
+        if (fixture.manager->floating()) {
+            fixture.manager->redockMenu(false);
+            processEvents();
+        }
+        destroyFixture(fixture);
+    }
+}
+
+}  // namespace bench
+}  // namespace ed
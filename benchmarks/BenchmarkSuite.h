@@ -0,0 +1,103 @@
+#ifndef ED_DOCKMENU_BENCHMARK_SUITE_H
+#define ED_DOCKMENU_BENCHMARK_SUITE_H
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+#include "AllocationCounter.h"
+
+class QMainWindow;
+
+namespace ed {
+
+class EMenuManager;
+
+namespace bench {
+
+/**
+ * All samples collected for a single metric, e.g. "addMenu/100"
+ */
+struct EBenchmarkResult {
+    QString name;
+    QString unit;
+    QList<double> samples;
+
+    double min() const;
+    double max() const;
+    double mean() const;
+    double median() const;
+    double stddev() const;
+
+    /**
+     * Median absolute deviation of the samples, a noise estimate that is
+     * not thrown off by single outliers
+     */
+    double medianAbsoluteDeviation() const;
+
+    QJsonObject toJson() const;
+    static EBenchmarkResult fromJson(const QJsonObject& object);
+};
+
+/**
+ * Times the core EMenuManager operations on the current QPA platform.
+ * The suite is meant to run under QT_QPA_PLATFORM=offscreen so that the
+ * numbers only contain the work done by the library and Qt, not by a
+ * compositor or a remote X server.
+ */
+class EBenchmarkSuite {
+public:
+    explicit EBenchmarkSuite(int repeat);
+
+    void runAll();
+
+    void benchAddMenu(int menuCount);
+    void benchStartup();
+    void benchToolSwitch();
+    void benchFloatRedock();
+    void benchTitleBarDrag();
+
+    /**
+     * Replays a recording of EInputReplay on a fixture with ten menus
+     */
+    void benchReplay(const QString& fileName, double speed);
+
+    const QList<EBenchmarkResult>& results() const;
+
+    /**
+     * Benchmarks that did not measure what they are meant to measure
+     */
+    const QStringList& failures() const;
+
+    /**
+     * Machine readable results of all metrics, one entry per metric
+     */
+    QJsonDocument toJson() const;
+
+private:
+    struct Fixture {
+        QMainWindow* window = nullptr;
+        EMenuManager* manager = nullptr;
+    };
+
+    Fixture createFixture(int menuCount, bool show);
+    void destroyFixture(Fixture& fixture);
+    void addSample(const QString& name, const QString& unit, double value);
+    void addFailure(const QString& message);
+
+    /**
+     * Adds the allocations per operation if allocation counting is enabled
+     */
+    void addAllocationSamples(const QString& name, const EAllocationCounter::Snapshot& delta, int operations = 1);
+
+    int m_repeat;
+    QList<EBenchmarkResult> m_results;
+    QStringList m_failures;
+};
+
+}  // namespace bench
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_BENCHMARK_SUITE_H
@@ -0,0 +1,141 @@
+#include <ed/dockmenu/Trace.h>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QFile>
+#include <QGuiApplication>
+#include <QTextStream>
+
+#include "BaselineComparison.h"
+#include "BenchmarkSuite.h"
+
+/**
+ * Headless benchmark of the core EMenuManager operations.
+ *
+ * Runs on the offscreen platform unless QT_QPA_PLATFORM is set explicitly and
+ * writes one JSON document per run, so results of different releases can be
+ * compared on the same machine. With --baseline the results are compared
+ * with such a document and the exit code is 2 on a significant slowdown.
+ */
+int main(int argc, char *argv[]) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", QByteArray("offscreen"));
+    }
+
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("eddockmenu_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks the core operations of the ED dock menu library");
+    parser.addHelpOption();
+    QCommandLineOption outputOption(QStringList() << "o" << "output", "Write the JSON results to <file>.", "file",
+                                    "eddockmenu_bench.json");
+    QCommandLineOption repeatOption(QStringList() << "r" << "repeat", "Repeat every benchmark <n> times.", "n", "5");
+    QCommandLineOption allocationsOption("allocations", "Count heap allocations per operation.");
+    QCommandLineOption replayOption("replay", "Also replay the EInputReplay recording <file>.", "file");
+    QCommandLineOption replaySpeedOption("replay-speed", "Replay speed factor, 0 replays as fast as possible.",
+                                         "speed", "1");
+    QCommandLineOption traceOption("trace", "Write a Chrome trace of the run to <file> (needs ED_ENABLE_TRACING).",
+                                   "file");
+    QCommandLineOption baselineOption("baseline",
+                                      "Compare the results with the earlier results <file> and exit with 2 on a "
+                                      "significant slowdown.",
+                                      "file");
+    QCommandLineOption thresholdOption("threshold", "Relative change in percent a metric must exceed to count.",
+                                       "percent", "10");
+    parser.addOption(outputOption);
+    parser.addOption(repeatOption);
+    parser.addOption(allocationsOption);
+    parser.addOption(replayOption);
+    parser.addOption(replaySpeedOption);
+    parser.addOption(traceOption);
+    parser.addOption(baselineOption);
+    parser.addOption(thresholdOption);
+    parser.process(app);
+
+    // Load the baseline first, so a wrong path fails before the whole run
+    ed::bench::EBaselineComparison baseline;
+    if (parser.isSet(baselineOption)) {
+        QString errorMessage;
+        if (!baseline.load(parser.value(baselineOption), &errorMessage)) {
+            qCritical().noquote() << errorMessage;
+            return 1;
+        }
+    }
+
+    ed::bench::EAllocationCounter::setEnabled(parser.isSet(allocationsOption));
+
+    if (parser.isSet(traceOption)) {
+        ed::ETraceSink::instance().setEnabled(true);
+    }
+
+    ed::bench::EBenchmarkSuite suite(parser.value(repeatOption).toInt());
+    suite.runAll();
+    for (const QString &fileName : parser.values(replayOption)) {
+        suite.benchReplay(fileName, parser.value(replaySpeedOption).toDouble());
+    }
+
+    QTextStream out(stdout);
+    for (const auto &result : suite.results()) {
+        out << QString("%1 %2 median=%3 min=%4 max=%5")
+                   .arg(result.name, -28)
+                   .arg(result.unit, -3)
+                   .arg(result.median(), 0, 'f', 4)
+                   .arg(result.min(), 0, 'f', 4)
+                   .arg(result.max(), 0, 'f', 4)
+            << Qt::endl;
+    }
+
+    QFile file(parser.value(outputOption));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCritical() << "Cannot write results to" << file.fileName();
+        return 1;
+    }
+    file.write(suite.toJson().toJson(QJsonDocument::Indented));
+    out << "Results written to " << file.fileName() << Qt::endl;
+
+    if (parser.isSet(traceOption)) {
+        ed::ETraceSink::instance().writeJson(parser.value(traceOption));
+    }
+
+    if (!suite.failures().isEmpty()) {
+        out << suite.failures().count() << " benchmark(s) failed" << Qt::endl;
+        return 1;
+    }
+
+    if (!parser.isSet(baselineOption)) {
+        return 0;
+    }
+
+    const QJsonObject environment = baseline.environment();
+    if (environment["qt"].toString() != QString::fromLatin1(qVersion()) ||
+        environment["platform"].toString() != QGuiApplication::platformName()) {
+        out << QString("Warning: baseline was recorded with Qt %1 on %2")
+                   .arg(environment["qt"].toString(), environment["platform"].toString())
+            << Qt::endl;
+    }
+
+    ed::bench::EBaselineComparison::Thresholds thresholds;
+    thresholds.relative = parser.value(thresholdOption).toDouble() / 100.0;
+    const auto comparisons = baseline.compare(suite.results(), thresholds);
+
+    out << Qt::endl << "Comparison with baseline " << parser.value(baselineOption) << Qt::endl;
+    for (const auto &comparison : comparisons) {
+        out << QString("%1 %2 %3 -> %4 (%5%6%, noise %7)")
+                   .arg(comparison.verdictName(), -10)
+                   .arg(comparison.name, -28)
+                   .arg(comparison.baselineMedian, 0, 'f', 4)
+                   .arg(comparison.currentMedian, 0, 'f', 4)
+                   .arg(comparison.change() >= 0 ? "+" : "")
+                   .arg(comparison.change() * 100, 0, 'f', 1)
+                   .arg(comparison.noise, 0, 'f', 4)
+            << Qt::endl;
+    }
+
+    if (ed::bench::EBaselineComparison::hasRegression(comparisons)) {
+        out << "Significant regressions found" << Qt::endl;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "StressDriver.h"
+
+#include <ed/dockmenu/MenuButton.h>
+#include <ed/dockmenu/MenuFloating.h>
+#include <ed/dockmenu/MenuManager.h>
+
+#include <QCoreApplication>
+#include <QTextStream>
+#include <QTimer>
+
+namespace {
+const char *const ActionNames[] = {"switch", "float", "redock"};
+}
+
+StressDriver::StressDriver(const QList<ed::EMenuManager *> &managers, int durationMs, quint32 seed, QObject *parent)
+    : QObject(parent), m_managers(managers), m_durationMs(durationMs), m_random(seed) {}
+
+void StressDriver::start() {
+    m_timer.start();
+    QTimer::singleShot(0, this, &StressDriver::step);
+}
+
+void StressDriver::step() {
+    if (m_timer.elapsed() >= m_durationMs) {
+        printResults();
+        Q_EMIT finished();
+        return;
+    }
+
+    ed::EMenuManager *manager = m_managers[m_random.bounded(int(m_managers.count()))];
+    Action action = Action(m_random.bounded(int(ActionCount)));
+
+    QElapsedTimer timer;
+    timer.start();
+    bool performed = false;
+    switch (action) {
+        case Switch: {
+            const auto buttons = manager->findChildren<ed::EMenuButton *>();
+            if (!buttons.isEmpty()) {
+                buttons[m_random.bounded(int(buttons.count()))]->click();
+                performed = true;
+            }
+        } break;
+
+        case Float:
+            if (!manager->floating()) {
+                ed::EMenuFloating *floating = new ed::EMenuFloating(manager);
+                floating->startFloating(manager->mapToGlobal(QPoint(20, 20)), manager->getMenuSize(),
+                                        ed::DraggingInactive);
+                performed = true;
+            }
+            break;
+
+        case Redock:
+            if (manager->floating()) {
+                manager->redockMenu(false);
+                performed = true;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (!performed) {
+        QTimer::singleShot(0, this, &StressDriver::step);
+        return;
+    }
+
+    // Include the layout and paint work triggered by the action
+    QCoreApplication::processEvents();
+    m_elapsedNs[action] += timer.nsecsElapsed();
+    m_count[action]++;
+
+    QTimer::singleShot(0, this, &StressDriver::step);
+}
+
+void StressDriver::printResults() {
+    QTextStream out(stdout);
+    const double seconds = m_timer.elapsed() / 1000.0;
+
+    qint64 total = 0;
+    for (int action = 0; action < ActionCount; ++action) {
+        total += m_count[action];
+        const double avgMs = m_count[action] > 0 ? m_elapsedNs[action] / 1.0e6 / m_count[action] : 0;
+        out << QString("%1 %2 actions, %3/s, avg %4 ms")
+                   .arg(ActionNames[action], -8)
+                   .arg(m_count[action])
+                   .arg(m_count[action] / seconds, 0, 'f', 1)
+                   .arg(avgMs, 0, 'f', 3)
+            << Qt::endl;
+    }
+    out << QString("total    %1 actions in %2 s, %3/s").arg(total).arg(seconds, 0, 'f', 1).arg(total / seconds, 0, 'f', 1)
+        << Qt::endl;
+
+    ed::EWidgetCensus census;
+    for (ed::EMenuManager *manager : m_managers) {
+        ed::EWidgetCensus managerCensus = manager->widgetCensus();
+        census.widgets += managerCensus.widgets;
+        census.nativeWindows += managerCensus.nativeWindows;
+        census.topLevelWindows += managerCensus.topLevelWindows;
+        census.backingStoreBytes += managerCensus.backingStoreBytes;
+    }
+    out << QString("library widgets=%1 nativeWindows=%2 topLevels=%3 backingStores=%4 KiB")
+               .arg(census.widgets)
+               .arg(census.nativeWindows)
+               .arg(census.topLevelWindows)
+               .arg(census.backingStoreBytes / 1024)
+        << Qt::endl;
+}
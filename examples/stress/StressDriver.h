@@ -0,0 +1,44 @@
+#ifndef STRESSDRIVER_H
+#define STRESSDRIVER_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QRandomGenerator>
+
+namespace ed {
+class EMenuManager;
+}
+
+/**
+ * Randomly switches, floats and redocks menus of the given managers for a
+ * fixed duration and prints the throughput of every action when done.
+ */
+class StressDriver : public QObject {
+    Q_OBJECT
+
+public:
+    StressDriver(const QList<ed::EMenuManager *> &managers, int durationMs, quint32 seed, QObject *parent = nullptr);
+
+    void start();
+
+Q_SIGNALS:
+    void finished();
+
+private Q_SLOTS:
+    void step();
+
+private:
+    enum Action { Switch, Float, Redock, ActionCount };
+
+    void printResults();
+
+    QList<ed::EMenuManager *> m_managers;
+    int m_durationMs;
+    QRandomGenerator m_random;
+    QElapsedTimer m_timer;
+    qint64 m_count[ActionCount] = {};
+    qint64 m_elapsedNs[ActionCount] = {};
+};
+
+#endif  // STRESSDRIVER_H
@@ -0,0 +1,41 @@
+#include "StressWindow.h"
+
+#include <QPlainTextEdit>
+#include <QTextEdit>
+
+namespace {
+const char *const IconNames[] = {"bookmark", "broadcast", "bug"};
+}
+
+StressWindow::StressWindow(int index, int menuCount, QWidget *parent) : QMainWindow(parent) {
+    setWindowTitle(QString("Stress Window %1").arg(index + 1));
+    setObjectName(QString("StressWindow%1").arg(index + 1));
+
+    const ed::MenuDirection directions[] = {ed::MenuDirection::Left, ed::MenuDirection::Right, ed::MenuDirection::Top,
+                                            ed::MenuDirection::Bottom};
+
+    // The first manager becomes the central widget of the window, every
+    // further manager the central widget of the previous one
+    QWidget *managerParent = this;
+    for (ed::MenuDirection direction : directions) {
+        m_managers.append(new ed::EMenuManager(direction, managerParent));
+        managerParent = nullptr;
+    }
+
+    for (int menu = 0; menu < menuCount; ++menu) {
+        ed::EMenuManager *manager = m_managers[menu % m_managers.count()];
+        QString icon = IconNames[menu % 3];
+        QString name = QString("Window %1 Menu %2").arg(index + 1).arg(menu + 1);
+        manager->addMenu(name, QString(":/ed/icons/light/%1.svg").arg(icon), QString(":/ed/icons/dark/%1.svg").arg(icon),
+                         name, new QTextEdit(name));
+    }
+
+    for (int manager = 0; manager < m_managers.count() - 1; ++manager) {
+        m_managers[manager]->setCentralWidget(m_managers[manager + 1]);
+    }
+    m_managers.last()->setCentralWidget(new QPlainTextEdit(QString("Central Widget %1").arg(index + 1)));
+}
+
+const QList<ed::EMenuManager *> &StressWindow::managers() const {
+    return m_managers;
+}
@@ -0,0 +1,25 @@
+#ifndef STRESSWINDOW_H
+#define STRESSWINDOW_H
+
+#include <ed/dockmenu/MenuManager.h>
+
+#include <QList>
+#include <QMainWindow>
+
+/**
+ * Main window with four nested menu managers, one for every direction.
+ * The menus are distributed round robin over the managers.
+ */
+class StressWindow : public QMainWindow {
+    Q_OBJECT
+
+public:
+    StressWindow(int index, int menuCount, QWidget *parent = nullptr);
+
+    const QList<ed::EMenuManager *> &managers() const;
+
+private:
+    QList<ed::EMenuManager *> m_managers;
+};
+
+#endif  // STRESSWINDOW_H
@@ -0,0 +1,65 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QList>
+#include <QtGlobal>
+
+#include "StressDriver.h"
+#include "StressWindow.h"
+
+const int WindowCount = 8;
+
+/**
+ * Scale workload for the library: 8 main windows with four nested managers
+ * each and 500 menus in total. With --script the menus are randomly
+ * switched, floated and redocked for a fixed duration.
+ */
+int main(int argc, char *argv[]) {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_DARWIN)
+    // the library has issues on wayland so we force qt to use x11 instead
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", QByteArray("xcb"));
+    }
+#endif
+
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("StressExample");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Stress test with many menus and menu managers");
+    parser.addHelpOption();
+    QCommandLineOption menusOption("menus", "Total number of menus.", "n", "500");
+    QCommandLineOption scriptOption("script", "Randomly switch, float and redock menus, then quit.");
+    QCommandLineOption durationOption("duration", "Duration of the scripted mode in seconds.", "seconds", "30");
+    QCommandLineOption seedOption("seed", "Seed of the scripted mode.", "seed", "1");
+    parser.addOption(menusOption);
+    parser.addOption(scriptOption);
+    parser.addOption(durationOption);
+    parser.addOption(seedOption);
+    parser.process(app);
+
+    const int menuCount = parser.value(menusOption).toInt();
+
+    QList<StressWindow *> windows;
+    QList<ed::EMenuManager *> managers;
+    for (int index = 0; index < WindowCount; ++index) {
+        // Spread the remainder over the first windows
+        int windowMenus = menuCount / WindowCount + (index < menuCount % WindowCount ? 1 : 0);
+        StressWindow *window = new StressWindow(index, windowMenus);
+        window->resize(1024, 768);
+        window->move(40 * index, 30 * index);
+        window->show();
+        windows.append(window);
+        managers.append(window->managers());
+    }
+
+    if (parser.isSet(scriptOption)) {
+        StressDriver *driver = new StressDriver(managers, parser.value(durationOption).toInt() * 1000,
+                                                parser.value(seedOption).toUInt(), &app);
+        QObject::connect(driver, &StressDriver::finished, &app, &QApplication::quit);
+        driver->start();
+    }
+
+    int result = app.exec();
+    qDeleteAll(windows);
+    return result;
+}
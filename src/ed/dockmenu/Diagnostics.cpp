@@ -0,0 +1,166 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/Diagnostics.h"
+
+#include <QStringList>
+#include <limits>
+
+namespace ed {
+
+qint64 EStartupTimings::totalNs() const {
+    return resourceInitNs + stylesheetReadNs + stylesheetApplyNs + constructionNs + addMenuNs + defaultSizeNs;
+}
+
+QString EStartupTimings::toString() const {
+    auto ms = [](qint64 ns) { return QString::number(ns / 1.0e6, 'f', 3); };
+    return QString("resourceInit=%1ms stylesheetRead=%2ms stylesheetApply=%3ms construction=%4ms "
+                   "addMenu=%5ms (%6 menus) defaultSize=%7ms total=%8ms")
+        .arg(ms(resourceInitNs), ms(stylesheetReadNs), ms(stylesheetApplyNs), ms(constructionNs), ms(addMenuNs))
+        .arg(addMenuCount)
+        .arg(ms(defaultSizeNs), ms(totalNs()));
+}
+
+QString EMenuStatistics::toString() const {
+    return QString("pixmapCaptures=%1 overlayShows=%2 overlayRepaints=%3 slideStarted=%4 slideDropped=%5 "
+                   "slideCompleted=%6 splitterHoverChanges=%7 mouseTrackerTicks=%8")
+        .arg(pixmapCaptures)
+        .arg(overlayShows)
+        .arg(overlayRepaints)
+        .arg(slideAnimationsStarted)
+        .arg(slideAnimationsDropped)
+        .arg(slideAnimationsCompleted)
+        .arg(splitterHoverChanges)
+        .arg(mouseTrackerTicks);
+}
+
+QString ETransitionStats::toString() const {
+    return QString("frames=%1 dropped=%2 duration=%3ms expected=%4ms min=%5ms avg=%6ms p99=%7ms max=%8ms")
+        .arg(frameCount)
+        .arg(droppedFrames)
+        .arg(durationMs, 0, 'f', 2)
+        .arg(expectedFrameMs, 0, 'f', 2)
+        .arg(minFrameMs, 0, 'f', 2)
+        .arg(avgFrameMs, 0, 'f', 2)
+        .arg(p99FrameMs, 0, 'f', 2)
+        .arg(maxFrameMs, 0, 'f', 2);
+}
+
+double ELatencyHistogram::bucketUpperBoundMs(int bucket) {
+    static const double bounds[BucketCount] = {1, 2, 4, 8, 16, 33, 66, std::numeric_limits<double>::infinity()};
+    return bounds[qBound(0, bucket, BucketCount - 1)];
+}
+
+void ELatencyHistogram::add(double latencyMs) {
+    int bucket = 0;
+    while (bucket < BucketCount - 1 && latencyMs >= bucketUpperBoundMs(bucket)) {
+        ++bucket;
+    }
+    buckets[bucket]++;
+
+    minMs = (count == 0) ? latencyMs : qMin(minMs, latencyMs);
+    maxMs = (count == 0) ? latencyMs : qMax(maxMs, latencyMs);
+    sumMs += latencyMs;
+    count++;
+}
+
+double ELatencyHistogram::avgMs() const {
+    return count > 0 ? sumMs / count : 0;
+}
+
+QString ELatencyHistogram::toString() const {
+    QStringList bucketList;
+    for (int bucket = 0; bucket < BucketCount; ++bucket) {
+        bucketList << QString::number(buckets[bucket]);
+    }
+    return QString("n=%1 min=%2ms avg=%3ms max=%4ms [%5]")
+        .arg(count)
+        .arg(minMs, 0, 'f', 2)
+        .arg(avgMs(), 0, 'f', 2)
+        .arg(maxMs, 0, 'f', 2)
+        .arg(bucketList.join(' '));
+}
+
+QString EDragLatencyReport::toString() const {
+    return QString("moves=%1 unpainted=%2 move: %3 overlay: %4 paint: %5")
+        .arg(moveEvents)
+        .arg(unpaintedMoves)
+        .arg(moveLatency.toString(), overlayLatency.toString(), paintLatency.toString());
+}
+
+QString EWidgetCensus::toString() const {
+    QStringList classes;
+    for (auto it = topLevelsByClass.cbegin(); it != topLevelsByClass.cend(); ++it) {
+        classes << QString("%1=%2").arg(it.key()).arg(it.value());
+    }
+
+    return QString("widgets=%1 nativeWindows=%2 topLevels=%3 visibleTopLevels=%4 backingStores=%5KiB (%6)")
+        .arg(widgets)
+        .arg(nativeWindows)
+        .arg(topLevelWindows)
+        .arg(visibleTopLevelWindows)
+        .arg(backingStoreBytes / 1024)
+        .arg(classes.join(' '));
+}
+
+qint64 EMemoryReport::hiddenPageBytes() const {
+    qint64 bytes = 0;
+    for (const auto& page : hiddenPages) {
+        bytes += page.estimatedBytes;
+    }
+    return bytes;
+}
+
+qint64 EMemoryReport::totalBytes() const {
+    return previewPixmapBytes + dropIndicatorBytes + buttonIconBytes + backingStoreBytes + hiddenPageBytes();
+}
+
+QString EStylesheetProfile::toString() const {
+    QStringList lines;
+    lines << QString("apply=%1ms widgets=%2 polished=%3")
+                 .arg(applyNs / 1.0e6, 0, 'f', 3)
+                 .arg(widgetsInSubtree)
+                 .arg(widgetsPolished);
+    for (const auto& rule : rules) {
+        lines << QString("  %1 %2ms rules=%3 matched=%4")
+                     .arg(rule.selector, -40)
+                     .arg(rule.costNs / 1.0e6, 0, 'f', 3)
+                     .arg(rule.rules)
+                     .arg(rule.matchedWidgets);
+    }
+    return lines.join('\n');
+}
+
+QString EMemoryReport::toString() const {
+    return QString("total=%1KiB preview=%2KiB dropIndicators=%3KiB buttonIcons=%4KiB backingStores=%5KiB "
+                   "hiddenPages=%6 (%7KiB)")
+        .arg(totalBytes() / 1024)
+        .arg(previewPixmapBytes / 1024)
+        .arg(dropIndicatorBytes / 1024)
+        .arg(buttonIconBytes / 1024)
+        .arg(backingStoreBytes / 1024)
+        .arg(hiddenPages.count())
+        .arg(hiddenPageBytes() / 1024);
+}
+
+}  // namespace ed
@@ -0,0 +1,207 @@
+#ifndef ED_DOCKMENU_DIAGNOSTICS_H
+#define ED_DOCKMENU_DIAGNOSTICS_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QList>
+#include <QMap>
+#include <QMetaType>
+#include <QString>
+
+#include "ed/dockmenu/ed_menu_globals.h"
+
+namespace ed {
+
+/**
+ * Wall clock time spent in the different phases of bringing up an
+ * EMenuManager. All durations are in nanoseconds.
+ */
+struct ED_EXPORT EStartupTimings {
+    qint64 resourceInitNs = 0;     //!< Q_INIT_RESOURCE, once per process
+    qint64 stylesheetReadNs = 0;   //!< reading the stylesheet from the resources
+    qint64 stylesheetApplyNs = 0;  //!< setStyleSheet() only, the subtree is polished at its first show
+    qint64 constructionNs = 0;     //!< widget construction, excluding the stylesheet phases
+    qint64 addMenuNs = 0;          //!< accumulated time of all addMenu() calls
+    int addMenuCount = 0;          //!< number of addMenu() calls
+    qint64 defaultSizeNs = 0;      //!< ESplitter::splitterReady -> setDefaultSize() pass
+
+    /**
+     * Sum of all phases
+     */
+    qint64 totalNs() const;
+
+    /**
+     * One line human readable summary in milliseconds
+     */
+    QString toString() const;
+};
+
+/**
+ * Counters for the work an EMenuManager does on behalf of the application.
+ * The counters are plain integers that are only touched from the GUI thread,
+ * so they are cheap enough to stay enabled all the time.
+ */
+struct ED_EXPORT EMenuStatistics {
+    quint64 pixmapCaptures = 0;            //!< captureMenuWidgets() calls
+    quint64 overlayShows = 0;              //!< drop overlay shown for a new target
+    quint64 overlayRepaints = 0;           //!< paint events of the drop overlay
+    quint64 slideAnimationsStarted = 0;    //!< slide transitions started
+    quint64 slideAnimationsDropped = 0;    //!< slide requests ignored because a transition was running
+    quint64 slideAnimationsCompleted = 0;  //!< slide transitions finished
+    quint64 splitterHoverChanges = 0;      //!< handle hover changes, they only repaint the hover overlay
+    quint64 mouseTrackerTicks = 0;         //!< MouseTracker positions delivered to the splitter
+
+    QString toString() const;
+};
+
+/**
+ * Frame intervals measured during one ESlidingStacked transition, from the
+ * paint events of the transition overlay. A frame counts as dropped for
+ * every refresh interval of the screen that passed without a paint.
+ */
+struct ED_EXPORT ETransitionStats {
+    int frameCount = 0;          //!< frames painted during the transition
+    int droppedFrames = 0;       //!< refresh intervals without a paint
+    double durationMs = 0;       //!< wall clock duration of the transition
+    double expectedFrameMs = 0;  //!< refresh interval of the screen
+    double minFrameMs = 0;
+    double avgFrameMs = 0;
+    double p99FrameMs = 0;
+    double maxFrameMs = 0;
+
+    QString toString() const;
+};
+
+/**
+ * Latency histogram with logarithmic buckets: < 1, 2, 4, 8, 16, 33, 66 ms
+ * and everything above
+ */
+struct ED_EXPORT ELatencyHistogram {
+    static constexpr int BucketCount = 8;
+
+    int buckets[BucketCount] = {};
+    int count = 0;
+    double minMs = 0;
+    double maxMs = 0;
+    double sumMs = 0;
+
+    /**
+     * Upper bound of the given bucket, the last bucket is unbounded
+     */
+    static double bucketUpperBoundMs(int bucket);
+
+    void add(double latencyMs);
+    double avgMs() const;
+    QString toString() const;
+};
+
+/**
+ * Input to screen latency of one title bar drag. Every mouse move is
+ * timestamped when it is dispatched and compared with the end of the first
+ * EDragPreview::moveFloating() and drop overlay update after it and with the
+ * next paint of the preview or the drop overlay. Moving a top level window
+ * usually needs no repaint, such moves are counted in unpaintedMoves.
+ */
+struct ED_EXPORT EDragLatencyReport {
+    int moveEvents = 0;
+    int unpaintedMoves = 0;
+    ELatencyHistogram moveLatency;     //!< input -> moveFloating() done
+    ELatencyHistogram overlayLatency;  //!< input -> updateDropOverlays() done
+    ELatencyHistogram paintLatency;    //!< input -> next paint
+
+    QString toString() const;
+};
+
+/**
+ * Widgets and windows created by the library for one EMenuManager. Widgets
+ * added by the application with addMenu() or setCentralWidget() and their
+ * children are not counted.
+ */
+struct ED_EXPORT EWidgetCensus {
+    int widgets = 0;                      //!< QWidget instances, including hidden ones
+    int nativeWindows = 0;                //!< widgets with a platform window handle
+    int topLevelWindows = 0;              //!< widgets that are windows, e.g. tooltips and overlays
+    int visibleTopLevelWindows = 0;       //!< top level windows that are currently shown
+    qint64 backingStoreBytes = 0;         //!< estimated size of all backing stores at 32 bits per pixel
+    QMap<QString, int> topLevelsByClass;  //!< top level windows per class name
+
+    QString toString() const;
+};
+
+/**
+ * Estimated memory of a menu page that is currently not shown
+ */
+struct ED_EXPORT EHiddenPageMemory {
+    QString name;
+    int widgets = 0;            //!< widgets of the page including the application widget
+    qint64 estimatedBytes = 0;  //!< widget objects plus pixmaps of labels in the page
+};
+
+/**
+ * Bytes held by the caches, pixmaps and windows of one EMenuManager. Icon
+ * and page sizes are estimates, QIcon rasterizes lazily and the size of a
+ * QWidget depends on the platform and the Qt build.
+ */
+struct ED_EXPORT EMemoryReport {
+    qint64 previewPixmapBytes = 0;  //!< EDragPreview content pixmap of a running drag
+    qint64 dropIndicatorBytes = 0;  //!< EOverlayCenter drop indicator pixmaps
+    qint64 buttonIconBytes = 0;     //!< EMenuButton icons rasterized at the button's icon size
+    qint64 backingStoreBytes = 0;   //!< see EWidgetCensus::backingStoreBytes
+    QList<EHiddenPageMemory> hiddenPages;
+
+    qint64 hiddenPageBytes() const;
+    qint64 totalBytes() const;
+    QString toString() const;
+};
+
+/**
+ * Cost of the rules of one selector in a stylesheet. The cost is the
+ * difference between applying the whole stylesheet and applying it without
+ * these rules, so it is noisy for cheap rules and can be 0.
+ */
+struct ED_EXPORT EStyleRuleCost {
+    QString selector;
+    int rules = 0;           //!< rule blocks with this selector
+    int matchedWidgets = 0;  //!< widgets matched by the type and object name of the selector
+    qint64 costNs = 0;
+};
+
+/**
+ * Result of profiling a setStyleSheet() call, see EStylesheetProfiler
+ */
+struct ED_EXPORT EStylesheetProfile {
+    qint64 applyNs = 0;        //!< setStyleSheet() with the whole stylesheet
+    int widgetsInSubtree = 0;  //!< widgets below the styled widget, including hosted ones
+    int widgetsPolished = 0;   //!< widgets that received a style change during the apply
+    QList<EStyleRuleCost> rules;
+
+    QString toString() const;
+};
+
+}  // namespace ed
+
+Q_DECLARE_METATYPE(ed::ETransitionStats)
+Q_DECLARE_METATYPE(ed::EDragLatencyReport)
+
+#endif  // ED_DOCKMENU_DIAGNOSTICS_H
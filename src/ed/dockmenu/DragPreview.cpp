@@ -23,6 +23,7 @@
 
 #include "ed/dockmenu/DragPreview.h"
 
+#include <QElapsedTimer>
 #include <QHBoxLayout>
 #include <QKeyEvent>
 #include <QLabel>
@@ -35,6 +36,9 @@
 #include "ed/dockmenu/MenuFloating.h"
 #include "ed/dockmenu/MenuManager.h"
 #include "ed/dockmenu/MenuOverlay.h"
+#include "ed/dockmenu/MouseTracker.h"
+#include "ed/dockmenu/PointerSource.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 
@@ -49,6 +53,20 @@ struct EDragPreview::Private {
     EMenuManager* menuManager;
     QPixmap contentPreviewPixmap;
     QPoint dragStartMousePosition;
+    QPoint movedCursorPosition;  // pointer position of the last moveFloating()
+
+    bool latencyProbe = false;
+    bool latencyReported = false;
+    QElapsedTimer latencyClock;
+    qint64 inputTimestamp = -1;
+    qint64 unpaintedInputTimestamp = -1;
+    qint64 movedInputTimestamp = -1;     // input the last move latency was recorded for
+    qint64 overlaidInputTimestamp = -1;  // input the last overlay latency was recorded for
+    EDragLatencyReport latencyReport;
+
+    double latencySince(qint64 timestamp) const {
+        return (latencyClock.nsecsElapsed() - timestamp) / 1.0e6;
+    }
 };
 
 EDragPreview::EDragPreview(EMenuManager* menuManager, QWidget* parent) : QWidget(parent), d(new Private) {
@@ -66,6 +84,11 @@ EDragPreview::EDragPreview(EMenuManager* menuManager, QWidget* parent) : QWidget
     d->menuManager = menuManager;
     d->dragCanceled = false;
     d->contentPreviewPixmap = menuManager->captureMenuWidgets();
+    menuManager->registerDragPreview(this);
+    d->latencyProbe = menuManager->dragLatencyProbeEnabled();
+    if (d->latencyProbe) {
+        d->latencyClock.start();
+    }
 
     d->layout = new QHBoxLayout(this);
     d->layout->setContentsMargins(0, 0, 0, 0);
@@ -86,11 +109,12 @@ EDragPreview::EDragPreview(EMenuManager* menuManager, QWidget* parent) : QWidget
 }
 
 EDragPreview::~EDragPreview() {
-    ED_PRINT("EDragPreview::~EDragPreview()");
+    ED_TRACE_INSTANT("lifetime", "EDragPreview::~EDragPreview");
     delete d;
 }
 
 void EDragPreview::startFloating(const QPoint& dragStartMousePos, const QSize& size) {
+    ED_TRACE_SCOPE("drag", "EDragPreview::startFloating");
     QScreen* screen = this->screen();
     QSize screenSize = screen->geometry().size();
     QSizeF reSize = QSizeF(qMin((double)size.width(), screenSize.width() * 0.8),
@@ -104,21 +128,51 @@ void EDragPreview::startFloating(const QPoint& dragStartMousePos, const QSize& s
     d->dragStartMousePosition = dragStartMousePos;
     moveFloating();
     show();
+
+    connect(&MouseTracker::instance(), &MouseTracker::dragSampled, this, &EDragPreview::onDragSampled);
+    MouseTracker::instance().beginDragSampling(this);
+}
+
+void EDragPreview::onDragSampled(const QPoint& pos) {
+    // The sampler only covers frames without input, the mouse move events
+    // already moved the preview to the current position
+    if (pos != d->movedCursorPosition) {
+        moveFloating();
+    }
+}
+
+void EDragPreview::stopDragSampling() {
+    disconnect(&MouseTracker::instance(), &MouseTracker::dragSampled, this, &EDragPreview::onDragSampled);
+    MouseTracker::instance().endDragSampling(this);
 }
 
 void EDragPreview::moveFloating() {
+    ED_TRACE_SCOPE("drag", "EDragPreview::moveFloating");
     int borderSize = (frameSize().width() - size().width()) / 2;
-    const QPoint moveToPos = QCursor::pos() - d->dragStartMousePosition - QPoint(borderSize, 0);
+    const QPoint cursorPos = EPointerSource::instance().position();
+    const QPoint moveToPos = cursorPos - d->dragStartMousePosition - QPoint(borderSize, 0);
     move(moveToPos);
+    d->movedCursorPosition = cursorPos;
+
+    // Sampler ticks without new input move to the same position again, only
+    // the first move after an input belongs to it
+    if (d->latencyProbe && d->inputTimestamp >= 0 && d->inputTimestamp != d->movedInputTimestamp) {
+        d->latencyReport.moveLatency.add(d->latencySince(d->inputTimestamp));
+        d->movedInputTimestamp = d->inputTimestamp;
+    }
 
     if (d->menuManager->floating()) {
-        this->updateDropOverlays(QCursor::pos());
+        this->updateDropOverlays(cursorPos);
     }
 }
 
 void EDragPreview::finishDragging() {
+    ED_TRACE_SCOPE("drag", "EDragPreview::finishDragging");
+    ED_TRACE_ASYNC_END("drag", "drag", this);
+    stopDragSampling();
+    reportLatency();
     QSize size = d->menuManager->getMenuSize();
-    QPoint point = this->mapFromGlobal(QCursor::pos());
+    QPoint point = this->mapFromGlobal(EPointerSource::instance().position());
 
     this->close();
     if (d->menuManager->floating()) {
@@ -135,7 +189,28 @@ void EDragPreview::finishDragging() {
     floating->startFloating(point, size, DraggingInactive);
 }
 
+qint64 EDragPreview::previewPixmapBytes() const {
+    return internal::pixmapBytes(d->contentPreviewPixmap);
+}
+
 bool EDragPreview::eventFilter(QObject* watched, QEvent* event) {
+    if (d->latencyProbe && !d->latencyReported) {
+        // Qt delivers every move to the QWidgetWindow and to the widget,
+        // count it once
+        if (event->type() == QEvent::MouseMove && watched->isWidgetType()) {
+            if (d->unpaintedInputTimestamp >= 0) {
+                d->latencyReport.unpaintedMoves++;
+            }
+            d->latencyReport.moveEvents++;
+            d->inputTimestamp = d->latencyClock.nsecsElapsed();
+            d->unpaintedInputTimestamp = d->inputTimestamp;
+        } else if (event->type() == QEvent::Paint && d->unpaintedInputTimestamp >= 0 &&
+                   (watched == d->label || watched == d->menuManager->menuOverlay())) {
+            d->latencyReport.paintLatency.add(d->latencySince(d->unpaintedInputTimestamp));
+            d->unpaintedInputTimestamp = -1;
+        }
+    }
+
     if (!d->dragCanceled && event->type() == QEvent::KeyPress) {
         QKeyEvent* e = static_cast<QKeyEvent*>(event);
         if (e->key() == Qt::Key_Escape) {
@@ -148,6 +223,10 @@ bool EDragPreview::eventFilter(QObject* watched, QEvent* event) {
 }
 
 void EDragPreview::cancelDragging() {
+    ED_TRACE_INSTANT("drag", "EDragPreview::cancelDragging");
+    ED_TRACE_ASYNC_END("drag", "drag", this);
+    stopDragSampling();
+    reportLatency();
     d->dragCanceled = true;
     Q_EMIT draggingCanceled();
 
@@ -164,6 +243,7 @@ void EDragPreview::onApplicationStateChanged(Qt::ApplicationState state) {
 }
 
 void EDragPreview::updateDropOverlays(const QPoint& globalPos) {
+    ED_TRACE_SCOPE("drag", "EDragPreview::updateDropOverlays");
     if (!this->isVisible() || !d->menuManager->floating()) {
         return;
     }
@@ -187,6 +267,23 @@ void EDragPreview::updateDropOverlays(const QPoint& globalPos) {
     }
 
     d->menuManager->menuOverlay()->showOverlay(d->menuManager);
+
+    if (d->latencyProbe && d->inputTimestamp >= 0 && d->inputTimestamp != d->overlaidInputTimestamp) {
+        d->latencyReport.overlayLatency.add(d->latencySince(d->inputTimestamp));
+        d->overlaidInputTimestamp = d->inputTimestamp;
+    }
+}
+
+void EDragPreview::reportLatency() {
+    if (!d->latencyProbe || d->latencyReported) {
+        return;
+    }
+
+    d->latencyReported = true;
+    if (d->unpaintedInputTimestamp >= 0) {
+        d->latencyReport.unpaintedMoves++;
+    }
+    d->menuManager->reportDragLatency(d->latencyReport);
 }
 
 }  // namespace ed
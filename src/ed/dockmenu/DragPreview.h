@@ -39,10 +39,16 @@ public:
 
     /**
      * We filter the events of the assigned content widget to receive
-     * escape key presses for canceling the drag operation
+     * escape key presses for canceling the drag operation. If the latency
+     * probe is enabled, mouse moves and paints are timestamped here too.
      */
     bool eventFilter(QObject* watched, QEvent* event) override;
 
+    /**
+     * Bytes held by the captured content pixmap
+     */
+    qint64 previewPixmapBytes() const;
+
 public:
     void startFloating(const QPoint& dragStartMousePos, const QSize& size);
 
@@ -72,9 +78,17 @@ private Q_SLOTS:
      */
     void onApplicationStateChanged(Qt::ApplicationState state);
 
+    /**
+     * Moves the preview with the pointer samples of the MouseTracker, so it
+     * follows at the refresh rate even if mouse events are coalesced
+     */
+    void onDragSampled(const QPoint& pos);
+
 private:
     void cancelDragging();
     void updateDropOverlays(const QPoint& globalPos);
+    void reportLatency();
+    void stopDragSampling();
 
 private:
     struct Private;
@@ -0,0 +1,290 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/InputReplay.h"
+
+#include <QApplication>
+#include <QCursor>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMouseEvent>
+#include <QPointer>
+#include <QTimer>
+
+#include "ed/dockmenu/MenuManager.h"
+#include "ed/dockmenu/PointerSource.h"
+
+namespace ed {
+
+namespace {
+QString typeName(QEvent::Type type) {
+    switch (type) {
+        case QEvent::MouseButtonPress:
+            return "press";
+        case QEvent::MouseButtonRelease:
+            return "release";
+        case QEvent::MouseMove:
+            return "move";
+        default:
+            return QString();
+    }
+}
+
+QEvent::Type typeFromName(const QString& name) {
+    if (name == "press") {
+        return QEvent::MouseButtonPress;
+    } else if (name == "release") {
+        return QEvent::MouseButtonRelease;
+    } else if (name == "move") {
+        return QEvent::MouseMove;
+    }
+    return QEvent::None;
+}
+}  // namespace
+
+struct EInputReplay::Private {
+    Private() = default;
+
+    QPointer<EMenuManager> menuManager;
+    QList<EInputEvent> events;
+
+    bool recording = false;
+    QElapsedTimer recordClock;
+    EInputEvent lastRecorded;
+    ulong lastTimestamp = 0;
+
+    bool replaying = false;
+    double speed = 1.0;
+    int nextIndex = 0;
+    QElapsedTimer replayClock;
+    QTimer* replayTimer;
+    QPointer<QWidget> grabWidget;
+
+    QPoint origin() const {
+        return menuManager ? menuManager->mapToGlobal(QPoint(0, 0)) : QPoint();
+    }
+};
+
+EInputReplay::EInputReplay(EMenuManager* manager, QObject* parent) : QObject(parent), d(new Private) {
+    d->menuManager = manager;
+    d->replayTimer = new QTimer(this);
+    d->replayTimer->setSingleShot(true);
+    d->replayTimer->setTimerType(Qt::PreciseTimer);
+    connect(d->replayTimer, &QTimer::timeout, this, &EInputReplay::replayNext);
+}
+
+EInputReplay::~EInputReplay() {
+    stopRecording();
+    delete d;
+}
+
+void EInputReplay::startRecording() {
+    if (d->recording) {
+        return;
+    }
+
+    d->events.clear();
+    d->lastRecorded = EInputEvent();
+    d->lastTimestamp = 0;
+    d->recording = true;
+    d->recordClock.start();
+    qApp->installEventFilter(this);
+}
+
+void EInputReplay::stopRecording() {
+    if (!d->recording) {
+        return;
+    }
+
+    d->recording = false;
+    qApp->removeEventFilter(this);
+}
+
+bool EInputReplay::isRecording() const {
+    return d->recording;
+}
+
+QList<EInputEvent> EInputReplay::events() const {
+    return d->events;
+}
+
+void EInputReplay::setEvents(const QList<EInputEvent>& events) {
+    d->events = events;
+}
+
+bool EInputReplay::eventFilter(QObject* watched, QEvent* event) {
+    if (!d->recording || !watched->isWidgetType() || typeName(event->type()).isEmpty()) {
+        return false;
+    }
+
+    // Mouse events that are propagated to parent widgets are new event objects
+    // with the same timestamp and global position, record them only once
+    QMouseEvent* mouseEvent = static_cast<QMouseEvent*>(event);
+    EInputEvent record;
+    record.timeMs = d->recordClock.elapsed();
+    record.type = event->type();
+    record.position = internal::globalPositionOf(mouseEvent) - d->origin();
+    record.button = mouseEvent->button();
+    record.buttons = mouseEvent->buttons();
+
+    if (!d->events.isEmpty() && mouseEvent->timestamp() == d->lastTimestamp &&
+        record.type == d->lastRecorded.type && record.position == d->lastRecorded.position) {
+        return false;
+    }
+
+    d->lastTimestamp = mouseEvent->timestamp();
+    d->lastRecorded = record;
+    d->events.append(record);
+    return false;
+}
+
+QByteArray EInputReplay::toJson() const {
+    QJsonArray events;
+    for (const auto& record : d->events) {
+        QJsonObject object;
+        object["t"] = record.timeMs;
+        object["type"] = typeName(record.type);
+        object["x"] = record.position.x();
+        object["y"] = record.position.y();
+        object["button"] = int(record.button);
+        object["buttons"] = int(record.buttons);
+        events.append(object);
+    }
+
+    QJsonObject root;
+    root["version"] = 1;
+    root["events"] = events;
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+bool EInputReplay::fromJson(const QByteArray& json) {
+    QJsonDocument document = QJsonDocument::fromJson(json);
+    if (!document.isObject() || document.object()["version"].toInt() != 1) {
+        return false;
+    }
+
+    QList<EInputEvent> events;
+    const QJsonArray array = document.object()["events"].toArray();
+    for (const auto& value : array) {
+        QJsonObject object = value.toObject();
+        EInputEvent record;
+        record.timeMs = qint64(object["t"].toDouble());
+        record.type = typeFromName(object["type"].toString());
+        record.position = QPoint(object["x"].toInt(), object["y"].toInt());
+        record.button = Qt::MouseButton(object["button"].toInt());
+        record.buttons = Qt::MouseButtons(object["buttons"].toInt());
+        if (record.type == QEvent::None) {
+            return false;
+        }
+        events.append(record);
+    }
+
+    d->events = events;
+    return true;
+}
+
+bool EInputReplay::save(const QString& fileName) const {
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    file.write(toJson());
+    return true;
+}
+
+bool EInputReplay::load(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    return fromJson(file.readAll());
+}
+
+void EInputReplay::replay(double speed) {
+    stopRecording();
+    stopReplay();
+
+    d->speed = qMax(0.0, speed);
+    d->nextIndex = 0;
+    d->grabWidget.clear();
+    d->replaying = true;
+    d->replayClock.start();
+    d->replayTimer->start(0);
+}
+
+void EInputReplay::stopReplay() {
+    d->replayTimer->stop();
+    d->replaying = false;
+}
+
+bool EInputReplay::isReplaying() const {
+    return d->replaying;
+}
+
+void EInputReplay::replayNext() {
+    if (!d->replaying) {
+        return;
+    }
+
+    if (d->nextIndex >= d->events.count() || d->menuManager.isNull()) {
+        d->replaying = false;
+        Q_EMIT replayFinished();
+        return;
+    }
+
+    const EInputEvent record = d->events.at(d->nextIndex++);
+    const QPoint globalPos = d->origin() + record.position;
+    QCursor::setPos(globalPos);
+    EPointerSource::instance().invalidate();
+
+    // Implicit mouse grab: everything between press and release goes to
+    // the widget that received the press
+    QWidget* target = d->grabWidget ? d->grabWidget.data() : QApplication::widgetAt(globalPos);
+    if (record.type == QEvent::MouseButtonPress && d->grabWidget.isNull()) {
+        d->grabWidget = target;
+    } else if (record.type == QEvent::MouseButtonRelease && record.buttons == Qt::NoButton) {
+        d->grabWidget.clear();
+    }
+
+    if (target != nullptr) {
+        QMouseEvent event(record.type, target->mapFromGlobal(globalPos), globalPos, record.button, record.buttons,
+                          Qt::NoModifier);
+        QApplication::sendEvent(target, &event);
+    }
+
+    if (d->nextIndex >= d->events.count()) {
+        d->replayTimer->start(0);
+        return;
+    }
+
+    qint64 dueMs = 0;
+    if (d->speed > 0) {
+        dueMs = qint64(d->events.at(d->nextIndex).timeMs / d->speed) - d->replayClock.elapsed();
+    }
+    d->replayTimer->start(int(qMax<qint64>(0, dueMs)));
+}
+
+}  // namespace ed
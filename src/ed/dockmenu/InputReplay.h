@@ -0,0 +1,110 @@
+#ifndef ED_DOCKMENU_INPUT_REPLAY_H
+#define ED_DOCKMENU_INPUT_REPLAY_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QByteArray>
+#include <QEvent>
+#include <QList>
+#include <QObject>
+#include <QPoint>
+
+#include "ed/dockmenu/ed_menu_globals.h"
+
+namespace ed {
+
+class EMenuManager;
+
+/**
+ * A single recorded mouse event. Positions are stored relative to the top
+ * left corner of the menu manager, so a recording can be replayed with the
+ * window at a different screen position.
+ */
+struct ED_EXPORT EInputEvent {
+    qint64 timeMs = 0;  //!< time since the start of the recording
+    QEvent::Type type = QEvent::None;
+    QPoint position;
+    Qt::MouseButton button = Qt::NoButton;
+    Qt::MouseButtons buttons = Qt::NoButton;
+};
+
+/**
+ * Records mouse press, move and release events of a live session and feeds
+ * them back with their original timing. Replayed events are delivered like
+ * Qt does it: to the widget under the cursor, and between press and release
+ * to the widget that received the press. The cursor position is updated
+ * before every event because the drag and drop code reads the global
+ * pointer position.
+ *
+ * Together with the offscreen platform this reproduces drags, floating and
+ * docking deterministically.
+ */
+class ED_EXPORT EInputReplay : public QObject {
+    Q_OBJECT
+
+public:
+    explicit EInputReplay(EMenuManager* manager, QObject* parent = nullptr);
+    ~EInputReplay() override;
+
+    /**
+     * Starts recording all mouse events of the application, replacing the
+     * current events
+     */
+    void startRecording();
+    void stopRecording();
+    bool isRecording() const;
+
+    QList<EInputEvent> events() const;
+    void setEvents(const QList<EInputEvent>& events);
+
+    QByteArray toJson() const;
+    bool fromJson(const QByteArray& json);
+
+    bool save(const QString& fileName) const;
+    bool load(const QString& fileName);
+
+    /**
+     * Replays the events. A speed of 2 replays twice as fast, a speed of 0
+     * replays as fast as possible. replayFinished() is emitted at the end.
+     */
+    void replay(double speed = 1.0);
+    void stopReplay();
+    bool isReplaying() const;
+
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+Q_SIGNALS:
+    void replayFinished();
+
+private Q_SLOTS:
+    void replayNext();
+
+private:
+    struct Private;
+    Private* d;
+};
+
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_INPUT_REPLAY_H
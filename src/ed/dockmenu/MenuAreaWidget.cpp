@@ -27,6 +27,7 @@
 
 #include "ed/dockmenu/MenuWidget.h"
 #include "ed/dockmenu/SlidingStacked.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 struct EMenuAreaWidget::Private {
@@ -57,6 +58,7 @@ EMenuAreaWidget::EMenuAreaWidget(MenuDirection direction, QWidget* parent) : QWi
     d->direction = direction;
     d->currentIndex = -1;
 
+    connect(d->stackedWidget, &ESlidingStacked::transitionStats, this, &EMenuAreaWidget::transitionStats);
     connect(d->stackedWidget, &ESlidingStacked::animationFinished, this, [this]() {
         if (d->currentIndex != -1) {
             d->stackedWidget->setCurrentIndex(d->currentIndex);
@@ -65,7 +67,7 @@ EMenuAreaWidget::EMenuAreaWidget(MenuDirection direction, QWidget* parent) : QWi
 }
 
 EMenuAreaWidget::~EMenuAreaWidget() {
-    ED_PRINT("EMenuAreaWidget::~EMenuAreaWidget");
+    ED_TRACE_INSTANT("lifetime", "EMenuAreaWidget::~EMenuAreaWidget");
     delete d;
 }
 
@@ -73,11 +75,34 @@ void EMenuAreaWidget::addMenuWidget(EMenuWidget* widget) {
     d->stackedWidget->addWidget(widget);
 }
 
+QList<EMenuWidget*> EMenuAreaWidget::menuWidgets() const {
+    QList<EMenuWidget*> widgets;
+    for (int idx = 0; idx < d->stackedWidget->count(); ++idx) {
+        if (EMenuWidget* widget = qobject_cast<EMenuWidget*>(d->stackedWidget->widget(idx))) {
+            widgets.append(widget);
+        }
+    }
+    return widgets;
+}
+
 void EMenuAreaWidget::toolSelected(int index) {
     d->currentIndex = index;
     d->stackedWidget->slideInIdx(index, ESlidingStacked::LEFT_TO_RIGHT);
 }
 
+void EMenuAreaWidget::setStatistics(EMenuStatistics* statistics) {
+    d->stackedWidget->setStatistics(statistics);
+}
+
+void EMenuAreaWidget::setTransitionStatsEnabled(bool enabled) {
+    d->stackedWidget->setFrameStatsEnabled(enabled);
+}
+
+void EMenuAreaWidget::setCurrentTool(int index) {
+    d->currentIndex = index;
+    d->stackedWidget->setCurrentIndex(index);
+}
+
 int EMenuAreaWidget::getCurrentIndex() const {
     return d->currentIndex;
 }
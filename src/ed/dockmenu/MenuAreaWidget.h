@@ -26,6 +26,7 @@
 
 #include <QWidget>
 
+#include "ed/dockmenu/Diagnostics.h"
 #include "ed/dockmenu/ed_menu_globals.h"
 
 namespace ed {
@@ -40,11 +41,25 @@ public:
     ~EMenuAreaWidget() override;
 
     void addMenuWidget(EMenuWidget* widget);
+    QList<EMenuWidget*> menuWidgets() const;
 
     int getCurrentIndex() const;
 
+    /**
+     * Shows the page index without the slide transition, for a collapsed
+     * area that is about to open
+     */
+    void setCurrentTool(int index);
+
     void updateState(bool floating);
 
+    void setStatistics(EMenuStatistics* statistics);
+
+    void setTransitionStatsEnabled(bool enabled);
+
+Q_SIGNALS:
+    void transitionStats(const ed::ETransitionStats& stats);
+
 public Q_SLOTS:
     void toolSelected(int index);
 
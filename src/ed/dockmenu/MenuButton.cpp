@@ -82,6 +82,19 @@ void EMenuButton::setColorHighlight(const QColor& Color) {
     d->colorHighlight = Color;
 }
 
+qint64 EMenuButton::iconBytes() const {
+    const qreal dpr = devicePixelRatioF();
+    const qint64 iconPixels = qint64(iconSize().width() * dpr) * qint64(iconSize().height() * dpr);
+
+    qint64 bytes = 0;
+    for (const QIcon* icon : {&d->normalIcon, &d->checkedIcon}) {
+        if (!icon->isNull()) {
+            bytes += iconPixels * 4;
+        }
+    }
+    return bytes;
+}
+
 void EMenuButton::setUpdated() {
     d->updated = true;
     update();
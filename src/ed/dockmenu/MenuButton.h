@@ -45,6 +45,12 @@ public:
 
     void setUpdated();
 
+    /**
+     * Estimated bytes of the normal and checked icon rasterized at the icon
+     * size and device pixel ratio of the button
+     */
+    qint64 iconBytes() const;
+
 protected:
     QColor colorHighlight() const;
     void setColorHighlight(const QColor& Color);
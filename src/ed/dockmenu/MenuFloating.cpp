@@ -38,6 +38,9 @@
 #include "ed/dockmenu/MenuManager.h"
 #include "ed/dockmenu/MenuOverlay.h"
 #include "ed/dockmenu/MenuTabBar.h"
+#include "ed/dockmenu/MouseTracker.h"
+#include "ed/dockmenu/PointerSource.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 
@@ -102,7 +105,7 @@ EMenuFloating::EMenuFloating(EMenuManager* menuManager) : QWidget(menuManager),
 }
 
 EMenuFloating::~EMenuFloating() {
-    ED_PRINT("EMenuFloating::~EMenuFloating");
+    ED_TRACE_INSTANT("lifetime", "EMenuFloating::~EMenuFloating");
     delete d;
 }
 
@@ -140,6 +143,7 @@ void EMenuFloating::onToolClosed() {
 }
 
 void EMenuFloating::startFloating(const QPoint& dragStartMousePos, const QSize& size, eDragState dragState) {
+    ED_TRACE_SCOPE("float", "EMenuFloating::startFloating");
     QScreen* screen = this->screen();
     QSize screenSize = screen->geometry().size();
     QSize reSize = QSize(qMin(size.width(), (int)(screenSize.width() * 0.85)),
@@ -147,19 +151,43 @@ void EMenuFloating::startFloating(const QPoint& dragStartMousePos, const QSize&
 
     resize(reSize);
     d->dragStartMousePosition = dragStartMousePos;
-    d->draggingState = dragState;
+    setDraggingState(dragState);
     moveFloating();
     show();
 }
 
+void EMenuFloating::setDraggingState(eDragState state) {
+    if (state == d->draggingState) {
+        return;
+    }
+
+    // Sample the pointer at the refresh rate while the window is dragged,
+    // the window system only reports moves of the window itself
+    if (state == DraggingFloatingWidget) {
+        connect(&MouseTracker::instance(), &MouseTracker::dragSampled, this, &EMenuFloating::onDragSampled);
+        MouseTracker::instance().beginDragSampling(this);
+    } else if (d->draggingState == DraggingFloatingWidget) {
+        disconnect(&MouseTracker::instance(), &MouseTracker::dragSampled, this, &EMenuFloating::onDragSampled);
+        MouseTracker::instance().endDragSampling(this);
+    }
+    d->draggingState = state;
+}
+
+void EMenuFloating::onDragSampled(const QPoint& pos) {
+    if (d->draggingState == DraggingFloatingWidget) {
+        this->updateDropOverlays(pos);
+    }
+}
+
 void EMenuFloating::moveFloating() {
+    ED_TRACE_SCOPE("float", "EMenuFloating::moveFloating");
     int borderSize = (frameSize().width() - size().width()) / 2;
-    const QPoint moveToPos = QCursor::pos() - d->dragStartMousePosition - QPoint(borderSize, 0);
+    const QPoint moveToPos = EPointerSource::instance().position() - d->dragStartMousePosition - QPoint(borderSize, 0);
     move(moveToPos);
 
     switch (d->draggingState) {
         case DraggingMousePressed:
-            d->draggingState = DraggingFloatingWidget;
+            setDraggingState(DraggingFloatingWidget);
             break;
 
         case DraggingFloatingWidget:
@@ -188,25 +216,25 @@ bool EMenuFloating::nativeEvent(const QByteArray& eventType, void* message, qint
     switch (msg->message) {
         case WM_MOVING: {
             if (d->draggingState == DraggingFloatingWidget) {
-                this->updateDropOverlays(QCursor::pos());
+                this->updateDropOverlays(EPointerSource::instance().position());
             }
         } break;
 
         case WM_NCLBUTTONDOWN:
             if (msg->wParam == HTCAPTION && d->draggingState == DraggingInactive) {
                 d->dragStartPos = pos();
-                d->draggingState = DraggingMousePressed;
+                setDraggingState(DraggingMousePressed);
             }
             break;
 
         case WM_NCLBUTTONDBLCLK:
-            d->draggingState = DraggingInactive;
+            setDraggingState(DraggingInactive);
             break;
 
         case WM_ENTERSIZEMOVE:
             if (d->draggingState == DraggingMousePressed) {
-                d->draggingState = DraggingFloatingWidget;
-                this->updateDropOverlays(QCursor::pos());
+                setDraggingState(DraggingFloatingWidget);
+                this->updateDropOverlays(EPointerSource::instance().position());
             }
             break;
 
@@ -245,14 +273,14 @@ bool EMenuFloating::event(QEvent* e) {
 #endif
             {
                 d->dragStartPos = pos();
-                d->draggingState = DraggingMousePressed;
+                setDraggingState(DraggingMousePressed);
             }
         } break;
 
         case DraggingMousePressed:
             switch (e->type()) {
                 case QEvent::NonClientAreaMouseButtonDblClick:
-                    d->draggingState = DraggingInactive;
+                    setDraggingState(DraggingInactive);
                     break;
 
                 case QEvent::Resize:
@@ -265,7 +293,7 @@ bool EMenuFloating::event(QEvent* e) {
                     // corner of the window frame or if it was caused by a windows state
                     // change, we check, if we are not in maximized state.
                     if (!isMaximized()) {
-                        d->draggingState = DraggingInactive;
+                        setDraggingState(DraggingInactive);
                     }
                     break;
 
@@ -291,12 +319,12 @@ void EMenuFloating::moveEvent(QMoveEvent* event) {
     QWidget::moveEvent(event);
     switch (d->draggingState) {
         case DraggingMousePressed:
-            d->draggingState = DraggingFloatingWidget;
-            this->updateDropOverlays(QCursor::pos());
+            setDraggingState(DraggingFloatingWidget);
+            this->updateDropOverlays(EPointerSource::instance().position());
             break;
 
         case DraggingFloatingWidget:
-            this->updateDropOverlays(QCursor::pos());
+            this->updateDropOverlays(EPointerSource::instance().position());
             // In OSX when hiding the DockAreaOverlay the application would set
             // the main window as the active window for some reason. This fixes
             // that by resetting the active window to the floating widget after
@@ -310,7 +338,7 @@ void EMenuFloating::moveEvent(QMoveEvent* event) {
 #endif
 
 void EMenuFloating::titleMouseReleaseEvent() {
-    d->draggingState = DraggingInactive;
+    setDraggingState(DraggingInactive);
 
     auto dropArea = d->menuManager->menuOverlay()->dropAreaUnderCursor();
     d->menuManager->menuOverlay()->hideOverlay();
@@ -322,8 +350,8 @@ void EMenuFloating::titleMouseReleaseEvent() {
 }
 
 void EMenuFloating::handleEscapeKey() {
-    ED_PRINT("EMenuFloating::handleEscapeKey()");
-    d->draggingState = DraggingInactive;
+    ED_TRACE_INSTANT("float", "EMenuFloating::handleEscapeKey");
+    setDraggingState(DraggingInactive);
     d->menuManager->menuOverlay()->hideOverlay();
 }
 
@@ -67,8 +67,10 @@ private:
     void titleMouseReleaseEvent();
     void handleEscapeKey();
     void updateDropOverlays(const QPoint& globalPos);
+    void setDraggingState(eDragState state);
 
 private Q_SLOTS:
+    void onDragSampled(const QPoint& pos);
     void onToolSelected(int index);
     void onToolClosed();
 
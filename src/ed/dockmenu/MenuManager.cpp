@@ -24,20 +24,35 @@
 #include "ed/dockmenu/MenuManager.h"
 
 #include <QApplication>
+#include <QBackingStore>
 #include <QBoxLayout>
+#include <QDataStream>
+#include <QElapsedTimer>
 #include <QFile>
+#include <QLabel>
 #include <QList>
+#include <QMap>
 #include <QMainWindow>
+#include <QMetaEnum>
 #include <QPainter>
+#include <QPointer>
 
+#include "ed/dockmenu/DragPreview.h"
 #include "ed/dockmenu/MenuAreaWidget.h"
 #include "ed/dockmenu/MenuButton.h"
 #include "ed/dockmenu/MenuFloating.h"
 #include "ed/dockmenu/MenuOverlay.h"
 #include "ed/dockmenu/MenuTabBar.h"
 #include "ed/dockmenu/MenuWidget.h"
+#include "ed/dockmenu/OverlayCenter.h"
 #include "ed/dockmenu/Provider.h"
+#include "ed/dockmenu/RepaintHeatmap.h"
 #include "ed/dockmenu/Splitter.h"
+#include "ed/dockmenu/SplitterTransition.h"
+#include "ed/dockmenu/StylesheetProfiler.h"
+#include "ed/dockmenu/Trace.h"
+
+static qint64 resourceInitNs = 0;
 
 /**
  * Initializes the resources specified by the .qrc file with the specified base
@@ -49,12 +64,37 @@
  * namespace
  */
 static void initDockMenuResource() {
+    QElapsedTimer timer;
+    timer.start();
     Q_INIT_RESOURCE(dockmenu);
+    resourceInitNs = timer.nsecsElapsed();
 }
 Q_COREAPP_STARTUP_FUNCTION(initDockMenuResource)
 
 namespace ed {
 
+/**
+ * Set ED_DOCKMENU_STARTUP_TIMINGS=1 to print the startup phases of every
+ * manager once its splitter became ready
+ */
+static bool dumpStartupTimings() {
+    static const bool dump = qEnvironmentVariableIntValue("ED_DOCKMENU_STARTUP_TIMINGS") > 0;
+    return dump;
+}
+
+/**
+ * Set ED_DOCKMENU_STYLESHEET_PROFILE=1 to profile the stylesheet of every
+ * manager when it is shown for the first time
+ */
+static bool profileStylesheets() {
+    static const bool profile = qEnvironmentVariableIntValue("ED_DOCKMENU_STYLESHEET_PROFILE") > 0;
+    return profile;
+}
+
+// Header of the saveState() data
+static const quint32 StateMarker = 0xED3E4D53;
+static const qint32 StateVersion = 1;
+
 struct EMenuManager::Private {
     Private() = default;
 
@@ -67,13 +107,31 @@ struct EMenuManager::Private {
     EMenuTabBar *styleBar;
     ESplitter *splitter;
     QList<int> splitterState;
+    ESplitterTransition *splitterTransition;
+    bool menuAnimation = true;
+
+    // Extent of the menu area per menu index, set by dragging the handle
+    QMap<int, int> menuExtents;
+    bool stateRestored = false;
 
     EMenuOverlay *menuOverlay;
     EMenuAreaWidget *menuArea;
     EMenuFloating *floatingWidget = nullptr;
+    QPointer<EDragPreview> dragPreview;
+
+    EStartupTimings startupTimings;
+    EMenuStatistics statistics;
+    bool dragLatencyProbe = false;
+    ERepaintHeatmap *repaintHeatmap = nullptr;
+
+    // Widgets of the application, excluded from widgetCensus()
+    QList<QPointer<QWidget>> userWidgets;
 };
 
 EMenuManager::EMenuManager(MenuDirection direction, QWidget *parent) : QFrame(parent), d(new Private) {
+    QElapsedTimer timer;
+    timer.start();
+
     setObjectName("EDockMenuManager");
     setFrameShape(QFrame::NoFrame);
     setFocusPolicy(Qt::NoFocus);
@@ -115,6 +173,14 @@ EMenuManager::EMenuManager(MenuDirection direction, QWidget *parent) : QFrame(pa
     }
 
     connect(d->splitter, &ESplitter::splitterReady, this, &EMenuManager::onSplitterReady);
+    connect(d->splitter, &ESplitter::handleDragFinished, this, &EMenuManager::onMenuDragFinished);
+
+    d->splitterTransition = new ESplitterTransition(d->splitter, this);
+
+    d->splitter->setStatistics(&d->statistics);
+    d->menuArea->setStatistics(&d->statistics);
+    d->menuOverlay->setStatistics(&d->statistics);
+    connect(d->menuArea, &EMenuAreaWidget::transitionStats, this, &EMenuManager::transitionStats);
 
     d->layout->setContentsMargins(QMargins(0, 0, 0, 0));
     d->layout->setSpacing(0);
@@ -129,23 +195,40 @@ EMenuManager::EMenuManager(MenuDirection direction, QWidget *parent) : QFrame(pa
     }
 
     this->loadStylesheet();
+
+    d->startupTimings.resourceInitNs = resourceInitNs;
+    d->startupTimings.constructionNs =
+        timer.nsecsElapsed() - d->startupTimings.stylesheetReadNs - d->startupTimings.stylesheetApplyNs;
 }
 
 EMenuManager::~EMenuManager() {
+    // The children are deleted after d, they must not count into it
+    d->splitter->setStatistics(nullptr);
+    d->menuArea->setStatistics(nullptr);
+    d->menuOverlay->setStatistics(nullptr);
     delete d;
 }
 
 void EMenuManager::addMenu(const QString &name, const QString &iconNormal, const QString &iconActive,
                            const QString &tooltip, QWidget *widget) {
+    QElapsedTimer timer;
+    timer.start();
+
     EMenuButton *button = new EMenuButton(d->direction, QSize(30, 30), iconNormal, iconActive, tooltip, this);
     d->styleBar->addMenuButton(button);
 
     EMenuWidget *menuWidget = new EMenuWidget(this, name, widget, this);
+    d->userWidgets.append(widget);
 
     d->menuArea->addMenuWidget(menuWidget);
+
+    d->startupTimings.addMenuNs += timer.nsecsElapsed();
+    d->startupTimings.addMenuCount++;
 }
 
 void EMenuManager::setCentralWidget(QWidget *widget) {
+    d->userWidgets.append(widget);
+
     switch (d->direction) {
         case MenuDirection::Left:
         case MenuDirection::Top:
@@ -167,9 +250,6 @@ void EMenuManager::setCentralWidget(QWidget *widget) {
             break;
     }
 
-    connect(qobject_cast<ESplitterHandle *>(d->splitter->handle(1)), &ESplitterHandle::dragFinished, this,
-            &EMenuManager::onMenuDragFinished);
-
     d->toolClosed = false;
     d->styleBar->setSelected(0);
     d->menuArea->toolSelected(0);
@@ -193,8 +273,7 @@ EMenuTabBar *EMenuManager::takeTabBar() {
 EMenuAreaWidget *EMenuManager::takeMenuAreaWidget() {
     int index = d->splitter->indexOf(d->menuArea);
     if (index != -1) {
-        disconnect(qobject_cast<ESplitterHandle *>(d->splitter->handle(1)), &ESplitterHandle::dragFinished, this,
-                   &EMenuManager::onMenuDragFinished);
+        d->splitterTransition->finish();
         d->splitter->widget(index)->setParent(nullptr);  // Detach
     }
     return d->menuArea;
@@ -204,7 +283,12 @@ EMenuOverlay *EMenuManager::menuOverlay() const {
     return d->menuOverlay;
 }
 
+void EMenuManager::registerDragPreview(EDragPreview *dragPreview) {
+    d->dragPreview = dragPreview;
+}
+
 void EMenuManager::registerFloatingWidget(EMenuFloating *floatingWidget) {
+    ED_TRACE_SCOPE("float", "EMenuManager::registerFloatingWidget");
     if (d->floatingWidget != nullptr) {
         d->floatingWidget->removeMenuWidget();
         d->floatingWidget->close();
@@ -218,6 +302,7 @@ void EMenuManager::redockMenu(bool closed) {
     if (d->floatingWidget == nullptr) {
         return;
     }
+    ED_TRACE_SCOPE("float", "EMenuManager::redockMenu");
 
     d->floatingWidget->removeMenuWidget();
     if (!closed) {
@@ -230,7 +315,7 @@ void EMenuManager::redockMenu(bool closed) {
         d->splitter->setCollapsible(0, true);
     } else {
         d->splitter->addWidget(d->menuArea);
-        d->splitter->setCollapsible(1, true);
+        d->splitter->setCollapsible(d->splitter->indexOf(d->menuArea), true);
     }
 
     if (!closed) {
@@ -244,9 +329,6 @@ void EMenuManager::redockMenu(bool closed) {
         d->toolClosed = true;
     }
 
-    connect(qobject_cast<ESplitterHandle *>(d->splitter->handle(1)), &ESplitterHandle::dragFinished, this,
-            &EMenuManager::onMenuDragFinished);
-
     d->layout->insertWidget(0, d->styleBar);
     connect(d->styleBar, &EMenuTabBar::toolSelected, this, &EMenuManager::onToolSelected);
     connect(d->styleBar, &EMenuTabBar::toolClosed, this, &EMenuManager::onToolClosed);
@@ -275,13 +357,77 @@ QSize EMenuManager::getMenuSize() const {
     return QSize(d->styleBar->size().width(), maxHeight);
 }
 
-QPixmap EMenuManager::captureMenuWidgets() {
-    QPixmap pixmaptabBar(d->styleBar->size());
-    d->styleBar->render(&pixmaptabBar);
+void EMenuManager::setSplitterResizeMode(eSplitterResizeMode mode) {
+    d->splitter->setResizeMode(mode);
+}
+
+eSplitterResizeMode EMenuManager::splitterResizeMode() const {
+    return d->splitter->resizeMode();
+}
+
+void EMenuManager::setSplitterResizeRate(int resizesPerSecond) {
+    d->splitter->setMaximumResizeRate(resizesPerSecond);
+}
+
+void EMenuManager::setMenuAnimationEnabled(bool enabled) {
+    d->menuAnimation = enabled;
+    if (!enabled) {
+        d->splitterTransition->finish();
+    }
+}
 
-    QPixmap pixmapMenuArea(d->menuArea->size());
-    d->menuArea->render(&pixmapMenuArea);
+bool EMenuManager::menuAnimationEnabled() const {
+    return d->menuAnimation;
+}
+
+QByteArray EMenuManager::saveState() const {
+    QByteArray state;
+    QDataStream stream(&state, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_5);
+    stream << StateMarker << StateVersion << qint32(d->menuArea->getCurrentIndex()) << d->toolClosed
+           << d->menuExtents;
+    return state;
+}
+
+bool EMenuManager::restoreState(const QByteArray &state) {
+    QDataStream stream(state);
+    stream.setVersion(QDataStream::Qt_5_5);
+
+    quint32 marker = 0;
+    qint32 version = 0;
+    stream >> marker >> version;
+    if (stream.status() != QDataStream::Ok || marker != StateMarker || version != StateVersion) {
+        return false;
+    }
+
+    qint32 currentIndex = -1;
+    bool closed = true;
+    QMap<int, int> extents;
+    stream >> currentIndex >> closed >> extents;
+    if (stream.status() != QDataStream::Ok) {
+        return false;
+    }
 
+    d->menuExtents = extents;
+    if (currentIndex >= 0 && currentIndex < d->menuArea->menuWidgets().count()) {
+        d->menuArea->setCurrentTool(currentIndex);
+    }
+    d->toolClosed = closed;
+    d->styleBar->setClose();
+    if (!closed) {
+        d->styleBar->setSelected(d->menuArea->getCurrentIndex());
+    }
+
+    d->stateRestored = true;
+    if (d->splitterReady) {
+        applyMenuState();
+    }
+    return true;
+}
+
+QPixmap EMenuManager::captureMenuWidgets() {
+    ED_TRACE_SCOPE("drag", "EMenuManager::captureMenuWidgets");
+    d->statistics.pixmapCaptures++;
     if (d->direction == MenuDirection::Left) {
         return internal::createPixmap(d->styleBar, d->menuArea, Qt::Horizontal);
     } else if (d->direction == MenuDirection::Right) {
@@ -293,6 +439,157 @@ QPixmap EMenuManager::captureMenuWidgets() {
     return internal::createPixmap(d->menuArea, d->styleBar, Qt::Vertical);
 }
 
+EStartupTimings EMenuManager::startupTimings() const {
+    return d->startupTimings;
+}
+
+EMenuStatistics EMenuManager::statistics() const {
+    return d->statistics;
+}
+
+void EMenuManager::resetStatistics() {
+    d->statistics = EMenuStatistics();
+}
+
+void EMenuManager::setTransitionStatsEnabled(bool enabled) {
+    d->menuArea->setTransitionStatsEnabled(enabled);
+}
+
+void EMenuManager::setDragLatencyProbeEnabled(bool enabled) {
+    d->dragLatencyProbe = enabled;
+}
+
+bool EMenuManager::dragLatencyProbeEnabled() const {
+    return d->dragLatencyProbe;
+}
+
+void EMenuManager::reportDragLatency(const EDragLatencyReport &report) {
+    Q_EMIT dragLatencyReport(report);
+}
+
+void EMenuManager::setRepaintHeatmapEnabled(bool enabled) {
+    if (enabled == repaintHeatmapEnabled()) {
+        return;
+    }
+
+    if (enabled) {
+        d->repaintHeatmap = new ERepaintHeatmap(this);
+    } else {
+        delete d->repaintHeatmap;
+        d->repaintHeatmap = nullptr;
+    }
+}
+
+bool EMenuManager::repaintHeatmapEnabled() const {
+    return d->repaintHeatmap != nullptr;
+}
+
+QHash<QString, qint64> EMenuManager::repaintAreaTotals() const {
+    return d->repaintHeatmap ? d->repaintHeatmap->repaintAreaTotals() : QHash<QString, qint64>();
+}
+
+void EMenuManager::resetRepaintAreaTotals() {
+    if (d->repaintHeatmap) {
+        d->repaintHeatmap->resetRepaintAreaTotals();
+    }
+}
+
+EWidgetCensus EMenuManager::widgetCensus() const {
+    EWidgetCensus census;
+
+    // Every widget of the library is a descendant of the manager, including
+    // the top level tooltips, overlays and the floating window. Only the drag
+    // preview has no parent.
+    QList<QWidget *> pending{const_cast<EMenuManager *>(this)};
+    if (!d->dragPreview.isNull()) {
+        pending.append(d->dragPreview.data());
+    }
+    while (!pending.isEmpty()) {
+        QWidget *widget = pending.takeLast();
+        census.widgets++;
+
+        if (widget->internalWinId() != 0) {
+            census.nativeWindows++;
+        }
+
+        if (widget->isWindow()) {
+            census.topLevelWindows++;
+            census.topLevelsByClass[widget->metaObject()->className()]++;
+            if (widget->isVisible()) {
+                census.visibleTopLevelWindows++;
+            }
+
+            if (QBackingStore *backingStore = widget->backingStore()) {
+                const qreal dpr = widget->devicePixelRatioF();
+                const QSize size = backingStore->size();
+                census.backingStoreBytes += qint64(size.width() * dpr) * qint64(size.height() * dpr) * 4;
+            }
+        }
+
+        // The repaint heatmap and the hover overlays come and go with
+        // diagnostics and hovering, they would distort the numbers
+        for (QObject *child : widget->children()) {
+            QWidget *childWidget = qobject_cast<QWidget *>(child);
+            if (childWidget == nullptr || d->userWidgets.contains(childWidget) || childWidget == d->repaintHeatmap ||
+                childWidget->objectName() == QLatin1String("ESplitterHandleHoverOverlay")) {
+                continue;
+            }
+            pending.append(childWidget);
+        }
+    }
+
+    return census;
+}
+
+EMemoryReport EMenuManager::memoryReport() const {
+    // Rough size of a QWidget with its private data, excluding layouts,
+    // style data and the contents of specialized widgets
+    const qint64 WidgetObjectBytes = 1024;
+
+    EMemoryReport report;
+    if (!d->dragPreview.isNull()) {
+        report.previewPixmapBytes = d->dragPreview->previewPixmapBytes();
+    }
+
+    const auto overlayCenters = findChildren<EOverlayCenter *>(Qt::FindDirectChildrenOnly);
+    for (EOverlayCenter *center : overlayCenters) {
+        report.dropIndicatorBytes += center->dropIndicatorBytes();
+    }
+
+    const auto buttons = d->styleBar->findChildren<EMenuButton *>();
+    for (EMenuButton *button : buttons) {
+        report.buttonIconBytes += button->iconBytes();
+    }
+
+    report.backingStoreBytes = widgetCensus().backingStoreBytes;
+
+    for (EMenuWidget *menuWidget : d->menuArea->menuWidgets()) {
+        if (menuWidget->isVisible()) {
+            continue;
+        }
+
+        EHiddenPageMemory page;
+        page.name = menuWidget->name();
+        const auto widgets = menuWidget->findChildren<QWidget *>();
+        page.widgets = widgets.count() + 1;
+        page.estimatedBytes = page.widgets * WidgetObjectBytes;
+        for (QWidget *widget : widgets) {
+            if (QLabel *label = qobject_cast<QLabel *>(widget)) {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+                page.estimatedBytes += internal::pixmapBytes(label->pixmap());
+#else
+                if (const QPixmap *pixmap = label->pixmap()) {
+                    page.estimatedBytes += internal::pixmapBytes(*pixmap);
+                }
+#endif
+            }
+        }
+        report.hiddenPages.append(page);
+    }
+
+    return report;
+}
+
 EProvider &EMenuManager::provider() {
     return ed::EProvider::instance();
 }
@@ -301,13 +598,21 @@ int EMenuManager::startDragDistance() {
     return QApplication::startDragDistance() * 1.5;
 }
 
-void EMenuManager::onMenuDragFinished() {
+void EMenuManager::onMenuDragFinished(int handleIndex) {
+    // Only the handle next to the menu area resizes it, the handle at the
+    // index of a widget lies before that widget
+    const int menuIndex = d->splitter->indexOf(d->menuArea);
+    if (menuIndex == -1 || (handleIndex != menuIndex && handleIndex != menuIndex + 1)) {
+        return;
+    }
+
     if (!menuVisible(d->splitter->sizes())) {
         d->toolClosed = true;
         d->styleBar->setClose();
         return;
     }
     d->splitterState = d->splitter->sizes();
+    d->menuExtents[d->menuArea->getCurrentIndex()] = menuExtent(d->splitterState);
 
     if (d->toolClosed) {
         int currentIndex = d->menuArea->getCurrentIndex();
@@ -326,31 +631,67 @@ void EMenuManager::onToolClosed() {
 }
 
 void EMenuManager::onToolSelected(int index) {
+    ED_TRACE_SCOPE("menu", "EMenuManager::onToolSelected");
     if (d->splitter->count() < 2) {
         return;
     }
 
     d->toolClosed = false;
+    const QList<int> extentSizes = menuExtentSizes(index);
 
     if (menuVisible(d->splitter->sizes())) {
+        // Resizing first lets the slide start with the page at its final
+        // size, so both changes reach the screen in the same frame
+        if (!extentSizes.isEmpty() && extentSizes != d->splitter->sizes()) {
+            d->splitterTransition->finish();
+            d->splitter->setSizes(extentSizes);
+        }
         d->menuArea->toolSelected(index);
         return;
     }
 
-    if (menuVisible(d->splitterState)) {
-        d->splitter->setSizes(d->splitterState);
-        d->menuArea->toolSelected(index);
-        return;
+    // The area opens with the selected page, sliding it in would only
+    // happen behind the snapshots of the transition
+    if (d->menuAnimation) {
+        d->menuArea->setCurrentTool(index);
     }
 
-    setDefaultSize();
-    d->menuArea->toolSelected(index);
+    if (!extentSizes.isEmpty()) {
+        resizeSplitter(extentSizes);
+    } else if (menuVisible(d->splitterState)) {
+        resizeSplitter(d->splitterState);
+    } else {
+        setDefaultSize();
+    }
+
+    if (!d->menuAnimation) {
+        d->menuArea->toolSelected(index);
+    }
 }
 
 void EMenuManager::onSplitterReady() {
     if (!d->splitterReady) {
-        setDefaultSize();
+        QElapsedTimer timer;
+        timer.start();
+        if (d->stateRestored) {
+            applyMenuState();
+        } else {
+            setDefaultSize();
+        }
+        d->startupTimings.defaultSizeNs = timer.nsecsElapsed();
         d->splitterReady = true;
+
+        if (dumpStartupTimings()) {
+            qInfo().noquote() << "EMenuManager" << QMetaEnum::fromType<MenuDirection>().valueToKey(d->direction)
+                              << "startup:" << d->startupTimings.toString();
+        }
+
+        // At the first show the menus and the central widget are added and
+        // polished, the profile covers the same subtree as later restyles
+        if (profileStylesheets()) {
+            qInfo().noquote() << "EMenuManager" << QMetaEnum::fromType<MenuDirection>().valueToKey(d->direction)
+                              << "stylesheet:" << profileStylesheet().toString();
+        }
     }
     d->splitterState = d->splitter->sizes();
 }
@@ -365,77 +706,123 @@ void EMenuManager::loadStylesheet() {
 #endif
     FileName += ".css";
 
-    ED_PRINT("Loading stylesheet: " << FileName);
-
+    ED_TRACE_SCOPE("startup", "EMenuManager::loadStylesheet");
+    QElapsedTimer timer;
+    timer.start();
     QFile StyleSheetFile(FileName);
     StyleSheetFile.open(QIODevice::ReadOnly);
     QTextStream StyleSheetStream(&StyleSheetFile);
     Result = StyleSheetStream.readAll();
     StyleSheetFile.close();
+    d->startupTimings.stylesheetReadNs = timer.nsecsElapsed();
+
+    timer.restart();
     this->setStyleSheet(Result);
+    d->startupTimings.stylesheetApplyNs = timer.nsecsElapsed();
+}
+
+EStylesheetProfile EMenuManager::profileStylesheet() {
+    ED_TRACE_SCOPE("startup", "EMenuManager::profileStylesheet");
+    return EStylesheetProfiler::profile(this, styleSheet());
 }
 
 void EMenuManager::setDefaultSize() {
     QSize size = d->splitter->size();
-    int menu_width = size.width() / 5;
-    int menu_height = size.height() / 5;
-
-    switch (d->direction) {
-        case MenuDirection::Left:
-            d->splitter->setSizes({menu_width, size.width() - menu_width});
-            break;
-        case MenuDirection::Right:
-            d->splitter->setSizes({size.width() - menu_width, menu_width});
-            break;
-
-        case MenuDirection::Top:
-            d->splitter->setSizes({menu_height, size.height() - menu_height});
-            break;
+    const int extent = d->splitter->orientation() == Qt::Horizontal ? size.width() / 5 : size.height() / 5;
+    const QList<int> sizes = sizesWithMenuExtent(extent);
+    if (!sizes.isEmpty()) {
+        resizeSplitter(sizes);
+    }
+}
 
-        case MenuDirection::Bottom:
-            d->splitter->setSizes({size.height() - menu_height, menu_height});
-            break;
+void EMenuManager::setClosedSize() {
+    const QList<int> sizes = sizesWithMenuExtent(0);
+    if (!sizes.isEmpty()) {
+        resizeSplitter(sizes);
+    }
+}
 
-        default:
-            break;
+void EMenuManager::resizeSplitter(const QList<int> &sizes) {
+    // The first sizes are set while the manager becomes visible
+    if (d->menuAnimation && d->splitterReady) {
+        d->splitterTransition->start(sizes);
+    } else {
+        d->splitter->setSizes(sizes);
     }
 }
 
-void EMenuManager::setClosedSize() {
-    QSize size = d->splitter->size();
+void EMenuManager::applyMenuState() {
+    if (d->splitter->count() < 2) {
+        return;
+    }
 
-    switch (d->direction) {
-        case MenuDirection::Left:
-            d->splitter->setSizes({0, size.width()});
-            break;
-        case MenuDirection::Right:
-            d->splitter->setSizes({size.width(), 0});
-            break;
+    if (d->toolClosed) {
+        setClosedSize();
+        return;
+    }
 
-        case MenuDirection::Top:
-            d->splitter->setSizes({0, size.height()});
-            break;
+    const QList<int> sizes = menuExtentSizes(d->menuArea->getCurrentIndex());
+    if (sizes.isEmpty()) {
+        setDefaultSize();
+    } else {
+        resizeSplitter(sizes);
+    }
+}
 
-        case MenuDirection::Bottom:
-            d->splitter->setSizes({size.height(), 0});
-            break;
+int EMenuManager::menuNeighbourIndex() const {
+    const int menuIndex = d->splitter->indexOf(d->menuArea);
+    if (menuIndex == -1 || d->splitter->count() < 2) {
+        return -1;
+    }
 
-        default:
-            break;
+    // The menu area gives space to and takes it from the pane on the side
+    // of the central widget
+    const bool centralAfterMenu = d->direction == MenuDirection::Left || d->direction == MenuDirection::Top;
+    int neighbourIndex = centralAfterMenu ? menuIndex + 1 : menuIndex - 1;
+    if (neighbourIndex < 0 || neighbourIndex >= d->splitter->count()) {
+        neighbourIndex = centralAfterMenu ? menuIndex - 1 : menuIndex + 1;
     }
+    return neighbourIndex;
 }
 
-bool EMenuManager::menuVisible(const QList<int> &sizes) {
-    if (sizes.isEmpty() || sizes.count() < 2) {
-        return false;
+int EMenuManager::menuExtent(const QList<int> &sizes) const {
+    const int menuIndex = d->splitter->indexOf(d->menuArea);
+    if (menuIndex == -1 || menuIndex >= sizes.count()) {
+        return 0;
     }
+    return sizes[menuIndex];
+}
 
-    if (d->direction == MenuDirection::Left || d->direction == MenuDirection::Top) {
-        return (sizes[0] != 0);
+QList<int> EMenuManager::sizesWithMenuExtent(int extent) const {
+    const int menuIndex = d->splitter->indexOf(d->menuArea);
+    const int neighbourIndex = menuNeighbourIndex();
+    QList<int> sizes = d->splitter->sizes();
+    if (neighbourIndex == -1 || sizes.count() != d->splitter->count()) {
+        return QList<int>();
+    }
+
+    // Only the menu area and its neighbour change, all other panes keep
+    // their sizes
+    const int total = sizes[menuIndex] + sizes[neighbourIndex];
+    if (total <= 0) {
+        return QList<int>();
+    }
+
+    sizes[menuIndex] = qBound(0, extent, total);
+    sizes[neighbourIndex] = total - sizes[menuIndex];
+    return sizes;
+}
+
+QList<int> EMenuManager::menuExtentSizes(int index) const {
+    auto it = d->menuExtents.constFind(index);
+    if (it == d->menuExtents.constEnd()) {
+        return QList<int>();
     }
+    return sizesWithMenuExtent(it.value());
+}
 
-    // Right & Bottom
-    return (sizes[1] != 0);
+bool EMenuManager::menuVisible(const QList<int> &sizes) {
+    return sizes.count() == d->splitter->count() && menuExtent(sizes) != 0;
 }
 
 }  // namespace ed
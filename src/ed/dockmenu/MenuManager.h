@@ -24,9 +24,12 @@
 /// \date   25.04.2025
 //============================================================================
 
+#include <QByteArray>
 #include <QFrame>
+#include <QHash>
 #include <QPixmap>
 
+#include "ed/dockmenu/Diagnostics.h"
 #include "ed/dockmenu/ed_menu_globals.h"
 
 namespace ed {
@@ -36,6 +39,9 @@ class EMenuTabBar;
 class EMenuOverlay;
 class EMenuAreaWidget;
 class EMenuFloating;
+class EDragPreview;
+class ERepaintHeatmap;
+class ESplitterTransition;
 
 class ED_EXPORT EMenuManager : public QFrame {
     Q_OBJECT
@@ -54,6 +60,32 @@ public:
 
     QSize getMenuSize() const;
 
+    /**
+     * How dragging the handle between the menu area and the central widget
+     * resizes them. Slow central widgets can use SplitterGhostResize or
+     * SplitterRateLimitedResize, see ESplitter::setResizeMode().
+     */
+    void setSplitterResizeMode(eSplitterResizeMode mode);
+    eSplitterResizeMode splitterResizeMode() const;
+    void setSplitterResizeRate(int resizesPerSecond);
+
+    /**
+     * Animates opening and closing the menu area with snapshots of the
+     * menu area and the central widget, see ESplitterTransition. Enabled
+     * by default.
+     */
+    void setMenuAnimationEnabled(bool enabled);
+    bool menuAnimationEnabled() const;
+
+    /**
+     * Every menu remembers the extent of the menu area the user dragged it
+     * to and opens with it. The state contains these extents, the current
+     * menu and whether the menu area is closed. Restoring before the
+     * manager is shown applies the state when its splitter becomes ready.
+     */
+    QByteArray saveState() const;
+    bool restoreState(const QByteArray& state);
+
     EMenuTabBar* takeTabBar();
     EMenuAreaWidget* takeMenuAreaWidget();
 
@@ -64,19 +96,108 @@ public:
 
     void registerFloatingWidget(EMenuFloating* floatingWidget);
 
+    /**
+     * The drag preview is a parentless window, registering it makes it
+     * visible to widgetCensus() and memoryReport()
+     */
+    void registerDragPreview(EDragPreview* dragPreview);
+
     QPixmap captureMenuWidgets();
 
+    /**
+     * Time spent in the startup phases of this manager. The values can also
+     * be printed by setting the environment variable
+     * ED_DOCKMENU_STARTUP_TIMINGS=1
+     */
+    EStartupTimings startupTimings() const;
+
+    /**
+     * Counters for the work done by this manager since construction or the
+     * last call of resetStatistics()
+     */
+    EMenuStatistics statistics() const;
+    void resetStatistics();
+
+    /**
+     * Enables frame time recording of the menu page transitions, see
+     * transitionStats()
+     */
+    void setTransitionStatsEnabled(bool enabled);
+
+    /**
+     * Enables the input latency probe for title bar drags, see
+     * dragLatencyReport()
+     */
+    void setDragLatencyProbeEnabled(bool enabled);
+    bool dragLatencyProbeEnabled() const;
+
+    /**
+     * Emits dragLatencyReport(), called by the drag preview when a probed
+     * drag finished or was canceled
+     */
+    void reportDragLatency(const EDragLatencyReport& report);
+
+    /**
+     * Shows a fading heatmap of all repainted areas on top of this manager
+     * and collects the repainted pixels per widget, see repaintAreaTotals()
+     */
+    void setRepaintHeatmapEnabled(bool enabled);
+    bool repaintHeatmapEnabled() const;
+    QHash<QString, qint64> repaintAreaTotals() const;
+    void resetRepaintAreaTotals();
+
+    /**
+     * Widgets, native windows and backing stores the library created for
+     * this manager, including its floating window, drag preview and
+     * tooltips. The widgets of the application, the repaint heatmap and the
+     * hover overlays of the splitter handles are not counted.
+     */
+    EWidgetCensus widgetCensus() const;
+
+    /**
+     * Bytes held by the pixmaps, icons and windows of this manager and an
+     * estimate for every menu page that is currently hidden
+     */
+    EMemoryReport memoryReport() const;
+
+    /**
+     * Profiles the stylesheet of this manager on its current subtree,
+     * including the hosted widgets, see EStylesheetProfiler. Setting
+     * ED_DOCKMENU_STYLESHEET_PROFILE=1 profiles every manager when it is
+     * shown for the first time and prints the result.
+     */
+    EStylesheetProfile profileStylesheet();
+
     static EProvider& provider();
     static int startDragDistance();
 
+Q_SIGNALS:
+    /**
+     * Emitted after every menu page transition if enabled by
+     * setTransitionStatsEnabled()
+     */
+    void transitionStats(const ed::ETransitionStats& stats);
+
+    /**
+     * Emitted when a title bar drag finished or was canceled if enabled by
+     * setDragLatencyProbeEnabled()
+     */
+    void dragLatencyReport(const ed::EDragLatencyReport& report);
+
 private:
     void loadStylesheet();
     void setDefaultSize();
     void setClosedSize();
+    void resizeSplitter(const QList<int>& sizes);
+    void applyMenuState();
+    int menuNeighbourIndex() const;
+    int menuExtent(const QList<int>& sizes) const;
+    QList<int> sizesWithMenuExtent(int extent) const;
+    QList<int> menuExtentSizes(int index) const;
     bool menuVisible(const QList<int>& sizes);
 
 private Q_SLOTS:
-    void onMenuDragFinished();
+    void onMenuDragFinished(int handleIndex);
     void onToolClosed();
     void onToolSelected(int index);
     void onSplitterReady();
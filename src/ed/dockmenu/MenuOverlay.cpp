@@ -26,8 +26,10 @@
 #include <QPainter>
 #include <QPointer>
 
+#include "ed/dockmenu/Diagnostics.h"
 #include "ed/dockmenu/MenuManager.h"
 #include "ed/dockmenu/OverlayCenter.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 
@@ -40,6 +42,7 @@ struct EMenuOverlay::Private {
     EOverlayCenter* Center;
     QPointer<QWidget> TargetWidget;
     MenuWidgetArea LastLocation = InvalidMenuWidgetArea;
+    EMenuStatistics* Statistics = nullptr;
 };
 
 EMenuOverlay::EMenuOverlay(QWidget* parent) : QFrame(parent), d(new Private()) {
@@ -80,6 +83,7 @@ MenuWidgetArea EMenuOverlay::visibleDropAreaUnderCursor() const {
 }
 
 MenuWidgetArea EMenuOverlay::showOverlay(QWidget* target) {
+    ED_TRACE_SCOPE("overlay", "EMenuOverlay::showOverlay");
     if (d->TargetWidget == target) {
         // Hint: We could update geometry of overlay here.
         MenuWidgetArea da = dropAreaUnderCursor();
@@ -92,6 +96,9 @@ MenuWidgetArea EMenuOverlay::showOverlay(QWidget* target) {
 
     d->TargetWidget = target;
     d->LastLocation = InvalidMenuWidgetArea;
+    if (d->Statistics) {
+        d->Statistics->overlayShows++;
+    }
 
     // Move it over the target.
     hide();
@@ -105,6 +112,7 @@ MenuWidgetArea EMenuOverlay::showOverlay(QWidget* target) {
 }
 
 void EMenuOverlay::hideOverlay() {
+    ED_TRACE_SCOPE("overlay", "EMenuOverlay::hideOverlay");
     hide();
     d->TargetWidget.clear();
     d->LastLocation = InvalidMenuWidgetArea;
@@ -116,12 +124,20 @@ void EMenuOverlay::enableDropPreview(bool Enable) {
     update();
 }
 
+void EMenuOverlay::setStatistics(EMenuStatistics* statistics) {
+    d->Statistics = statistics;
+}
+
 bool EMenuOverlay::dropPreviewEnabled() const {
     return d->DropPreviewEnabled;
 }
 
 void EMenuOverlay::paintEvent(QPaintEvent* event) {
     Q_UNUSED(event);
+    ED_TRACE_SCOPE("overlay", "EMenuOverlay::paintEvent");
+    if (d->Statistics) {
+        d->Statistics->overlayRepaints++;
+    }
 
     // Draw rect based on location
     if (!d->DropPreviewEnabled) {
@@ -30,6 +30,8 @@
 
 namespace ed {
 
+struct EMenuStatistics;
+
 /*!
  * EMenuOverlay paints a translucent rectangle over another widget. The geometry
  * of the rectangle is based on the mouse location.
@@ -96,6 +98,11 @@ public:
      */
     QRect dropOverlayRect() const;
 
+    /**
+     * Counters of the owning manager, may be nullptr
+     */
+    void setStatistics(EMenuStatistics* statistics);
+
     /**
      * Handle polish events
      */
@@ -26,6 +26,7 @@
 #include <QBoxLayout>
 
 #include "ed/dockmenu/MenuButton.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 
@@ -61,7 +62,7 @@ EMenuTabBar::EMenuTabBar(MenuDirection direction, QWidget* parent) : QScrollArea
 }
 
 EMenuTabBar::~EMenuTabBar() {
-    ED_PRINT("EMenuTabBar::~EMenuTabBar");
+    ED_TRACE_INSTANT("lifetime", "EMenuTabBar::~EMenuTabBar");
     delete d;
 }
 
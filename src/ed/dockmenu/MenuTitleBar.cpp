@@ -33,6 +33,8 @@
 #include "ed/dockmenu/MenuFloating.h"
 #include "ed/dockmenu/MenuManager.h"
 #include "ed/dockmenu/MenuTitleBar_p.h"
+#include "ed/dockmenu/PointerSource.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 
@@ -181,8 +183,10 @@ void EMenuTitleBar::mouseMoveEvent(QMouseEvent* ev) {
     if (DragDistanceY >= EMenuManager::startDragDistance() || mouseOutsideBar) {
         QSize size = d->menuManager->getMenuSize();
 
+        ED_TRACE_SCOPE("drag", "EMenuTitleBar::startDrag");
         d->dragState = DraggingFloatingWidget;
         d->dragPreviewWidget = new EDragPreview(d->menuManager);
+        ED_TRACE_ASYNC_BEGIN("drag", "drag", d->dragPreviewWidget);
         this->connect(d->dragPreviewWidget, &EDragPreview::draggingCanceled,
                       [this]() { this->d->dragState = DraggingInactive; });
 
@@ -195,7 +199,7 @@ void EMenuTitleBar::mouseMoveEvent(QMouseEvent* ev) {
 
 void EMenuTitleBar::onUndockButtonClicked() {
     QSize size = d->menuManager->getMenuSize();
-    QPoint point = this->mapFromGlobal(QCursor::pos());
+    QPoint point = this->mapFromGlobal(EPointerSource::instance().position());
 
     EMenuFloating* floating = new EMenuFloating(d->menuManager);
     floating->startFloating(point, size, DraggingInactive);
@@ -26,6 +26,7 @@
 #include <QBoxLayout>
 
 #include "ed/dockmenu/MenuTitleBar.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 struct EMenuWidget::Private {
@@ -33,6 +34,7 @@ struct EMenuWidget::Private {
 
     QBoxLayout* layout;
     EMenuTitleBar* titleBar;
+    QString name;
 };
 
 EMenuWidget::EMenuWidget(EMenuManager* manager, const QString& name, QWidget* widget, QWidget* parent)
@@ -47,6 +49,7 @@ EMenuWidget::EMenuWidget(EMenuManager* manager, const QString& name, QWidget* wi
     d->layout->setContentsMargins(0, 0, 0, 0);
     d->layout->setSpacing(0);
 
+    d->name = name;
     d->titleBar = new EMenuTitleBar(manager, name, this);
 
     d->layout->addWidget(d->titleBar);
@@ -57,8 +60,12 @@ void EMenuWidget::updateState(bool floating) {
     d->titleBar->updateState(floating);
 }
 
+QString EMenuWidget::name() const {
+    return d->name;
+}
+
 EMenuWidget::~EMenuWidget() {
-    ED_PRINT("EMenuWidget::~EMenuWidget");
+    ED_TRACE_INSTANT("lifetime", "EMenuWidget::~EMenuWidget");
     delete d;
 }
 
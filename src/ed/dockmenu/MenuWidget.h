@@ -41,6 +41,8 @@ public:
 
     void updateState(bool floating);
 
+    QString name() const;
+
 private:
     struct Private;
     Private* d;
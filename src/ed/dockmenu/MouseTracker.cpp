@@ -23,20 +23,56 @@
 
 #include "ed/dockmenu/MouseTracker.h"
 
+#include <QApplication>
 #include <QCursor>
 #include <QDebug>
+#include <QEnterEvent>
+#include <QGuiApplication>
+#include <QHoverEvent>
+#include <QScreen>
+#include <QWidget>
+#include <QWindow>
+
+#include "ed/dockmenu/PointerSource.h"
 
 namespace ed {
 
-MouseTracker::MouseTracker(QObject* parent) : QObject(parent), m_timer(new QTimer(this)) {
+namespace {
+// Fallback polls with an unchanged position before polling stops again
+const int MaxStablePolls = 2;
+
+// Edge length of a hot zone grid cell in pixels
+const int HotZoneCellSize = 128;
+
+int cellIndex(int coordinate) {
+    return coordinate >= 0 ? coordinate / HotZoneCellSize : (coordinate + 1) / HotZoneCellSize - 1;
+}
+
+quint64 cellKey(int column, int row) {
+    return (quint64(quint32(column)) << 32) | quint32(row);
+}
+
+int refreshIntervalMs(const QPoint& globalPos) {
+    QScreen* screen = QGuiApplication::screenAt(globalPos);
+    if (screen == nullptr) {
+        screen = QGuiApplication::primaryScreen();
+    }
+
+    const qreal refreshRate = screen != nullptr && screen->refreshRate() > 0 ? screen->refreshRate() : 60.0;
+    return qMax(1, qRound(1000.0 / refreshRate));
+}
+}  // namespace
+
+MouseTracker::MouseTracker(QObject* parent)
+    : QObject(parent), m_timer(new QTimer(this)), m_dragTimer(new QTimer(this)) {
     connect(m_timer, &QTimer::timeout, this, &MouseTracker::trackMouse);
-    start();
+    m_dragTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_dragTimer, &QTimer::timeout, this, &MouseTracker::sampleDrag);
+    connect(qApp, &QGuiApplication::applicationStateChanged, this, &MouseTracker::updateRunning);
 }
 
 MouseTracker::~MouseTracker() {
-    if (m_timer->isActive()) {
-        m_timer->stop();
-    }
+    stop();
     delete m_timer;
 }
 
@@ -48,8 +84,10 @@ MouseTracker& MouseTracker::instance() {
 }
 
 void MouseTracker::start(int intervalMs) {
-    if (!m_timer->isActive()) {
-        m_timer->start(intervalMs);
+    m_timer->setInterval(intervalMs);
+    if (!m_running) {
+        qApp->installEventFilter(this);
+        m_running = true;
     }
 }
 
@@ -57,10 +95,326 @@ void MouseTracker::stop() {
     if (m_timer->isActive()) {
         m_timer->stop();
     }
+    if (m_running) {
+        qApp->removeEventFilter(this);
+        m_running = false;
+    }
+}
+
+void MouseTracker::beginDragSampling(QObject* client) {
+    if (m_dragClients.contains(client)) {
+        return;
+    }
+
+    m_dragClients.insert(client, connect(client, &QObject::destroyed, this, [this, client]() { endDragSampling(client); }));
+    if (!m_dragTimer->isActive()) {
+        m_lastDragSample = EPointerSource::instance().position();
+        m_dragTimer->start(refreshIntervalMs(m_lastDragSample));
+    }
+}
+
+void MouseTracker::endDragSampling(QObject* client) {
+    auto it = m_dragClients.find(client);
+    if (it == m_dragClients.end()) {
+        return;
+    }
+
+    disconnect(it.value());
+    m_dragClients.erase(it);
+    if (m_dragClients.isEmpty()) {
+        m_dragTimer->stop();
+    }
+}
+
+bool MouseTracker::isDragSampling() const {
+    return m_dragTimer->isActive();
+}
+
+void MouseTracker::sampleDrag() {
+    const QPoint pos = EPointerSource::instance().position();
+    if (pos == m_lastDragSample) {
+        return;
+    }
+
+    // Follow the refresh rate of the screen the pointer moved to
+    const int interval = refreshIntervalMs(pos);
+    if (interval != m_dragTimer->interval()) {
+        m_dragTimer->setInterval(interval);
+    }
+
+    m_lastDragSample = pos;
+    Q_EMIT dragSampled(pos);
+}
+
+bool MouseTracker::isRunning() const {
+    return m_running;
+}
+
+void MouseTracker::subscribe(QWidget* subscriber) {
+    if (m_subscribers[subscriber]++ == 0) {
+        subscriber->installEventFilter(this);
+        m_subscriberConnections[subscriber] = connect(subscriber, &QObject::destroyed, this, [this, subscriber]() {
+            m_subscribers.remove(subscriber);
+            m_subscriberConnections.remove(subscriber);
+            clearHotZones(subscriber);
+            updateRunning();
+        });
+        watchWindow(subscriber);
+    }
+    updateRunning();
+}
+
+void MouseTracker::unsubscribe(QWidget* subscriber) {
+    auto it = m_subscribers.find(subscriber);
+    if (it == m_subscribers.end()) {
+        return;
+    }
+
+    if (--it.value() == 0) {
+        m_subscribers.erase(it);
+        clearHotZones(subscriber);
+        subscriber->removeEventFilter(this);
+        disconnect(m_subscriberConnections.take(subscriber));
+    }
+    updateRunning();
+}
+
+void MouseTracker::setHotZones(QWidget* subscriber, const QList<QRect>& windowZones, HotZoneCallback callback) {
+    if (!m_subscribers.contains(subscriber)) {
+        return;
+    }
+
+    HotZoneSubscriber& entry = m_hotZones[subscriber];
+    QWidget* oldWindow = entry.window;
+    entry.window = subscriber->window();
+    entry.zones = windowZones;
+    entry.callback = std::move(callback);
+
+    if (oldWindow != nullptr && oldWindow != entry.window) {
+        rebuildHotZoneGrid(oldWindow);
+    }
+    rebuildHotZoneGrid(entry.window);
+}
+
+void MouseTracker::clearHotZones(QWidget* subscriber) {
+    auto it = m_hotZones.find(subscriber);
+    if (it == m_hotZones.end()) {
+        return;
+    }
+
+    QWidget* window = it->window;
+    m_hotZones.erase(it);
+    m_insideHotZone.remove(subscriber);
+    rebuildHotZoneGrid(window);
+}
+
+void MouseTracker::rebuildHotZoneGrid(QWidget* window) {
+    QHash<quint64, HotZoneCell> grid;
+    for (auto it = m_hotZones.cbegin(); it != m_hotZones.cend(); ++it) {
+        if (it->window != window) {
+            continue;
+        }
+
+        for (const QRect& zone : it->zones) {
+            for (int column = cellIndex(zone.left()); column <= cellIndex(zone.right()); ++column) {
+                for (int row = cellIndex(zone.top()); row <= cellIndex(zone.bottom()); ++row) {
+                    grid[cellKey(column, row)].append({it.key(), zone});
+                }
+            }
+        }
+    }
+
+    if (grid.isEmpty()) {
+        m_hotZoneGrids.remove(window);
+    } else {
+        m_hotZoneGrids.insert(window, grid);
+    }
+}
+
+void MouseTracker::dispatchHotZones(const QPoint& pos) {
+    QSet<QWidget*> inside;
+    for (auto it = m_hotZoneGrids.cbegin(); it != m_hotZoneGrids.cend(); ++it) {
+        QWidget* window = it.key();
+        if (!window->isVisible()) {
+            continue;
+        }
+
+        const QPoint local = window->mapFromGlobal(pos);
+        auto cell = it->constFind(cellKey(cellIndex(local.x()), cellIndex(local.y())));
+        if (cell == it->cend()) {
+            continue;
+        }
+
+        for (const auto& zone : *cell) {
+            if (zone.second.contains(local)) {
+                inside.insert(zone.first);
+            }
+        }
+    }
+
+    // Subscribers whose zones were entered, moved in or left
+    const QSet<QWidget*> targets = inside + m_insideHotZone;
+    m_insideHotZone = inside;
+    for (QWidget* subscriber : targets) {
+        auto entry = m_hotZones.constFind(subscriber);
+        if (entry != m_hotZones.cend() && entry->callback) {
+            entry->callback(pos);
+        }
+    }
+}
+
+void MouseTracker::watchWindow(QWidget* subscriber) {
+    // Minimizing is reported to the top level widget, exposure only to
+    // its QWindow, which exists once the window was shown
+    QWidget* window = subscriber->window();
+    window->installEventFilter(this);
+    m_watched.insert(window, window);
+    if (window->windowHandle() != nullptr) {
+        window->windowHandle()->installEventFilter(this);
+        m_watched.insert(window->windowHandle(), window->windowHandle());
+    }
+}
+
+void MouseTracker::scheduleUpdateRunning() {
+    // Hiding a window hides all subscribers in it, evaluate them only once
+    if (!m_updatePending) {
+        m_updatePending = true;
+        QTimer::singleShot(0, this, &MouseTracker::updateRunning);
+    }
+}
+
+bool MouseTracker::subscriberActive(QWidget* subscriber) const {
+    if (!subscriber->isVisible()) {
+        return false;
+    }
+
+    QWidget* window = subscriber->window();
+    if (window->isMinimized()) {
+        return false;
+    }
+    return window->windowHandle() == nullptr || window->windowHandle()->isExposed();
+}
+
+void MouseTracker::updateRunning() {
+    m_updatePending = false;
+
+    // Windows of former subscribers and reparented ones drop out here
+    const QHash<QObject*, QPointer<QObject>> previouslyWatched = m_watched;
+    m_watched.clear();
+    for (auto it = m_subscribers.cbegin(); it != m_subscribers.cend(); ++it) {
+        watchWindow(it.key());
+    }
+    for (auto it = previouslyWatched.cbegin(); it != previouslyWatched.cend(); ++it) {
+        // A subscriber that is a window itself keeps its filter
+        QObject* object = it.value();
+        if (object != nullptr && !m_watched.contains(object) &&
+            !(object->isWidgetType() && m_subscribers.contains(static_cast<QWidget*>(object)))) {
+            object->removeEventFilter(this);
+        }
+    }
+
+    bool active = false;
+    if (QGuiApplication::applicationState() == Qt::ApplicationActive) {
+        for (auto it = m_subscribers.cbegin(); it != m_subscribers.cend(); ++it) {
+            if (subscriberActive(it.key())) {
+                active = true;
+                break;
+            }
+        }
+    }
+
+    if (active) {
+        start();
+    } else {
+        stop();
+    }
+}
+
+bool MouseTracker::eventFilter(QObject* watched, QEvent* event) {
+    switch (event->type()) {
+        case QEvent::Show:
+        case QEvent::Hide:
+        case QEvent::ParentChange:
+        case QEvent::WindowStateChange:
+        case QEvent::Expose:
+            // The filter on the application sees these events of all other
+            // widgets too, only subscribers and their windows are of interest
+            if (m_watched.contains(watched) ||
+                (watched->isWidgetType() && m_subscribers.contains(static_cast<QWidget*>(watched)))) {
+                scheduleUpdateRunning();
+            }
+            return false;
+
+        default:
+            break;
+    }
+
+    if (!m_running || !watched->isWidgetType()) {
+        return false;
+    }
+
+    QWidget* widget = static_cast<QWidget*>(watched);
+    switch (event->type()) {
+        case QEvent::MouseMove:
+            updatePosition(internal::globalPositionOf(static_cast<QMouseEvent*>(event)));
+            break;
+
+        case QEvent::HoverMove: {
+            QHoverEvent* hoverEvent = static_cast<QHoverEvent*>(event);
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
+            updatePosition(widget->mapToGlobal(hoverEvent->position().toPoint()));
+#else
+            updatePosition(widget->mapToGlobal(hoverEvent->pos()));
+#endif
+        } break;
+
+        case QEvent::Enter: {
+            // The pointer is back in one of our windows, events take over
+            m_timer->stop();
+            QEnterEvent* enterEvent = static_cast<QEnterEvent*>(event);
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
+            updatePosition(enterEvent->globalPosition().toPoint());
+#else
+            updatePosition(enterEvent->globalPos());
+#endif
+        } break;
+
+        case QEvent::Leave:
+            // Outside of our windows no events arrive, poll until the
+            // pointer comes to rest or enters one of our windows again
+            if (widget->isWindow()) {
+                m_stablePolls = 0;
+                m_timer->start();
+            }
+            break;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+void MouseTracker::updatePosition(const QPoint& pos) {
+    // Move events propagate to the parents, so every position usually
+    // arrives several times
+    if (pos == m_lastPos) {
+        return;
+    }
+    m_lastPos = pos;
+    dispatchHotZones(pos);
+    Q_EMIT mouseMoved(pos);
 }
 
 void MouseTracker::trackMouse() {
-    QPoint pos = QCursor::pos();
-    Q_EMIT mouseMoved(pos);  // Optional: emit if you want observers
+    QPoint pos = EPointerSource::instance().position();
+    if (pos == m_lastPos) {
+        if (++m_stablePolls >= MaxStablePolls) {
+            m_timer->stop();
+        }
+        return;
+    }
+
+    m_stablePolls = 0;
+    updatePosition(pos);
 }
 }  // namespace ed
@@ -26,12 +26,40 @@
 
 #include <ed/dockmenu/ed_menu_globals.h>
 
+#include <QHash>
+#include <QList>
 #include <QObject>
 #include <QPoint>
+#include <QPointer>
+#include <QRect>
+#include <QSet>
 #include <QTimer>
+#include <functional>
 
 namespace ed {
 
+/**
+ * Reports the global pointer position to the splitters, so they can hide
+ * a hovered handle once the pointer left it.
+ *
+ * The tracker is event driven: it watches the mouse move, hover and
+ * enter events of all widgets of the application and emits mouseMoved()
+ * only when the position changed. Polling the EPointerSource is only used
+ * after the pointer left one of our windows and only as long as the
+ * position keeps changing, so an idle application causes no wakeups.
+ *
+ * Consumers register with subscribe() and unsubscribe(). The tracker only
+ * runs while the application is active and at least one subscriber is
+ * visible in a window that is neither minimized nor fully obscured.
+ *
+ * Subscribers that only care about certain areas register hot zones.
+ * Their callback is only called while the pointer enters, moves inside or
+ * leaves one of their zones, instead of for every position.
+ *
+ * While a menu is dragged, beginDragSampling() additionally samples the
+ * pointer once per refresh interval of the screen under the pointer and
+ * emits dragSampled(), independent of the delivered mouse events.
+ */
 class ED_EXPORT MouseTracker : public QObject {
     Q_OBJECT
 
@@ -39,21 +67,93 @@ public:
     static MouseTracker& instance();
     void stop();
 
+    /**
+     * Registers interest in mouseMoved(). Subscriptions are reference counted,
+     * a widget that subscribed twice has to unsubscribe twice. Destroyed
+     * widgets are removed automatically.
+     */
+    void subscribe(QWidget* subscriber);
+    void unsubscribe(QWidget* subscriber);
+
+    using HotZoneCallback = std::function<void(const QPoint& globalPos)>;
+
+    /**
+     * Replaces the hot zones of a subscriber. The zones are given in
+     * coordinates of the subscriber's window, so moving the window keeps
+     * them valid, the subscriber updates them when it moves inside the
+     * window. The zones are dropped on the last unsubscribe().
+     */
+    void setHotZones(QWidget* subscriber, const QList<QRect>& windowZones, HotZoneCallback callback);
+    void clearHotZones(QWidget* subscriber);
+
+    /**
+     * Starts sampling for the given client until endDragSampling() is called
+     * for it or it is destroyed. Sampling runs while any client needs it.
+     */
+    void beginDragSampling(QObject* client);
+    void endDragSampling(QObject* client);
+    bool isDragSampling() const;
+
+    /**
+     * True while the event filter is installed
+     */
+    bool isRunning() const;
+
     ~MouseTracker() override;
 
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
 Q_SIGNALS:
     void mouseMoved(const QPoint& pos);  // Optional signal if others need to observe
 
+    /**
+     * A changed pointer position sampled during a drag
+     */
+    void dragSampled(const QPoint& pos);
+
 public Q_SLOTS:
     void trackMouse();
 
+private Q_SLOTS:
+    void sampleDrag();
+
 private:
     explicit MouseTracker(QObject* parent = nullptr);
     void start(int intervalMs = 120);
+    void updatePosition(const QPoint& pos);
+    void updateRunning();
+    void scheduleUpdateRunning();
+    bool subscriberActive(QWidget* subscriber) const;
+    void watchWindow(QWidget* subscriber);
+    void rebuildHotZoneGrid(QWidget* window);
+    void dispatchHotZones(const QPoint& pos);
 
 private:
     inline static MouseTracker* m_instance = nullptr;
     QTimer* m_timer;
+    QPoint m_lastPos;
+    int m_stablePolls = 0;
+    bool m_running = false;
+    QHash<QWidget*, int> m_subscribers;
+    QHash<QWidget*, QMetaObject::Connection> m_subscriberConnections;  //!< destroyed() cleanup per subscriber
+    QHash<QObject*, QPointer<QObject>> m_watched;  //!< windows and QWindows of the subscribers
+    bool m_updatePending = false;
+
+    struct HotZoneSubscriber {
+        QWidget* window = nullptr;
+        QList<QRect> zones;
+        HotZoneCallback callback;
+    };
+
+    // Uniform grid per window, every cell lists the zones overlapping it
+    using HotZoneCell = QList<QPair<QWidget*, QRect>>;
+    QHash<QWidget*, HotZoneSubscriber> m_hotZones;
+    QHash<QWidget*, QHash<quint64, HotZoneCell>> m_hotZoneGrids;
+    QSet<QWidget*> m_insideHotZone;  //!< subscribers the pointer was inside at the last position
+
+    QTimer* m_dragTimer;
+    QHash<QObject*, QMetaObject::Connection> m_dragClients;  //!< destroyed() cleanup per client
+    QPoint m_lastDragSample;
 };
 }  // namespace ed
 
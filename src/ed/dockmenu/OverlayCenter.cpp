@@ -28,6 +28,7 @@
 #include <QWindow>
 
 #include "ed/dockmenu/MenuOverlay.h"
+#include "ed/dockmenu/PointerSource.h"
 
 namespace ed {
 
@@ -169,7 +170,7 @@ void EOverlayCenter::setAreaWidgets(const QHash<MenuWidgetArea, QWidget*>& widge
 }
 
 MenuWidgetArea EOverlayCenter::cursorLocation() const {
-    const QPoint pos = mapFromGlobal(QCursor::pos());
+    const QPoint pos = mapFromGlobal(EPointerSource::instance().position());
     QHashIterator<MenuWidgetArea, QWidget*> i(d->DropIndicatorWidgets);
 
     while (i.hasNext()) {
@@ -297,6 +298,24 @@ void EOverlayCenter::updateDropIndicatorIcon(QWidget* DropIndicatorWidget) {
     l->setPixmap(createHighDpiDropIndicatorPixmap(size, (MenuWidgetArea)Area));
 }
 
+qint64 EOverlayCenter::dropIndicatorBytes() const {
+    qint64 bytes = 0;
+    for (QWidget* widget : d->DropIndicatorWidgets) {
+        QLabel* l = qobject_cast<QLabel*>(widget);
+        if (l == nullptr) {
+            continue;
+        }
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        bytes += internal::pixmapBytes(l->pixmap());
+#else
+        if (const QPixmap* pixmap = l->pixmap()) {
+            bytes += internal::pixmapBytes(*pixmap);
+        }
+#endif
+    }
+    return bytes;
+}
+
 QPixmap EOverlayCenter::createHighDpiDropIndicatorPixmap(const QSizeF& size, MenuWidgetArea widgetArea) {
     QColor borderColor = iconColor(EOverlayCenter::FrameColor);
     QColor backgroundColor = iconColor(EOverlayCenter::WindowBackgroundColor);
@@ -123,6 +123,11 @@ public:
      */
     QColor iconColor(eIconColor ColorIndex) const;
 
+    /**
+     * Bytes held by the pixmaps of the drop indicators
+     */
+    qint64 dropIndicatorBytes() const;
+
     /**
      * Returns the dock widget area depending on the current cursor location.
      * The function checks, if the mouse cursor is inside of any drop indicator
@@ -0,0 +1,210 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/PointerSource.h"
+
+#include <QCursor>
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QScreen>
+#include <QTimer>
+#include <cstdlib>
+
+namespace ed {
+
+struct EPointerSource::Private {
+    Private() = default;
+
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    xcb_connection_t* connection = nullptr;
+    xcb_window_t root = 0;
+    bool requestPending = false;
+    xcb_query_pointer_cookie_t cookie;
+    QElapsedTimer requestAge;
+    double roundTripMs = 0;  // smoothed, from the replies that were waited for
+#endif
+
+    QPoint position;
+    bool positionValid = false;
+    bool endOfPassScheduled = false;
+    int maxReplyAgeMs = 8;
+};
+
+EPointerSource::EPointerSource(QObject* parent) : QObject(parent), d(new Private) {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    if (QGuiApplication::platformName() == "xcb") {
+        // An own connection keeps the replies out of the event queue of Qt
+        int screenNumber = 0;
+        d->connection = xcb_connect(nullptr, &screenNumber);
+        if (xcb_connection_has_error(d->connection)) {
+            xcb_disconnect(d->connection);
+            d->connection = nullptr;
+        } else {
+            xcb_screen_iterator_t it = xcb_setup_roots_iterator(xcb_get_setup(d->connection));
+            for (int index = 0; index < screenNumber && it.rem > 0; ++index) {
+                xcb_screen_next(&it);
+            }
+            d->root = it.data->root;
+        }
+    }
+#endif
+}
+
+EPointerSource::~EPointerSource() {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    if (d->connection != nullptr) {
+        xcb_disconnect(d->connection);
+    }
+#endif
+    delete d;
+}
+
+EPointerSource& EPointerSource::instance() {
+    if (!m_instance) {
+        m_instance = new EPointerSource();
+    }
+    return *m_instance;
+}
+
+bool EPointerSource::isNative() const {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    if (d->connection == nullptr) {
+        return false;
+    }
+
+    // xcb reports native pixels, mapping them is only trivial without scaling
+    const auto screens = QGuiApplication::screens();
+    for (const QScreen* screen : screens) {
+        if (!qFuzzyCompare(screen->devicePixelRatio(), 1.0)) {
+            return false;
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void EPointerSource::setMaxReplyAgeMs(int ms) {
+    d->maxReplyAgeMs = ms;
+}
+
+int EPointerSource::maxReplyAgeMs() const {
+    return d->maxReplyAgeMs;
+}
+
+QPoint EPointerSource::position() {
+    if (!d->positionValid) {
+        d->position = queryPosition();
+        d->positionValid = true;
+    }
+
+    if (!d->endOfPassScheduled) {
+        d->endOfPassScheduled = true;
+        QTimer::singleShot(0, this, &EPointerSource::endOfPass);
+    }
+    return d->position;
+}
+
+void EPointerSource::invalidate() {
+    d->positionValid = false;
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    // A prefetched reply may describe the position before the change
+    if (d->requestPending) {
+        xcb_discard_reply(d->connection, d->cookie.sequence);
+        d->requestPending = false;
+    }
+#endif
+}
+
+void EPointerSource::prefetch() {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    if (d->connection == nullptr || d->requestPending || !isNative()) {
+        return;
+    }
+
+    d->cookie = xcb_query_pointer(d->connection, d->root);
+    xcb_flush(d->connection);
+    d->requestPending = true;
+    d->requestAge.start();
+#endif
+}
+
+void EPointerSource::endOfPass() {
+    d->endOfPassScheduled = false;
+    d->positionValid = false;
+
+    // The position was needed in this pass, during a drag it will be needed
+    // again in the next one
+    prefetch();
+}
+
+QPoint EPointerSource::queryPosition() {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    if (isNative()) {
+        if (d->requestPending) {
+            void* reply = nullptr;
+            xcb_generic_error_t* error = nullptr;
+            if (xcb_poll_for_reply(d->connection, d->cookie.sequence, &reply, &error)) {
+                // The reply already arrived. It is used unless a new round
+                // trip would return a position more than maxReplyAgeMs()
+                // newer.
+                d->requestPending = false;
+                free(error);
+                if (reply != nullptr && d->requestAge.elapsed() <= d->maxReplyAgeMs + d->roundTripMs) {
+                    auto* pointerReply = static_cast<xcb_query_pointer_reply_t*>(reply);
+                    QPoint pos(pointerReply->root_x, pointerReply->root_y);
+                    free(reply);
+                    return pos;
+                }
+                free(reply);
+            } else {
+                // A request in flight answers sooner than a new one
+                return waitForReply();
+            }
+        }
+
+        prefetch();
+        return waitForReply();
+    }
+#endif
+    return QCursor::pos();
+}
+
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+QPoint EPointerSource::waitForReply() {
+    d->requestPending = false;
+    xcb_query_pointer_reply_t* reply = xcb_query_pointer_reply(d->connection, d->cookie, nullptr);
+    if (reply == nullptr) {
+        return QCursor::pos();
+    }
+
+    const double roundTripMs = d->requestAge.nsecsElapsed() / 1.0e6;
+    d->roundTripMs = d->roundTripMs > 0 ? (7 * d->roundTripMs + roundTripMs) / 8 : roundTripMs;
+    QPoint pos(reply->root_x, reply->root_y);
+    free(reply);
+    return pos;
+}
+#endif
+
+}  // namespace ed
@@ -0,0 +1,101 @@
+#ifndef ED_DOCKMENU_POINTER_SOURCE_H
+#define ED_DOCKMENU_POINTER_SOURCE_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QObject>
+#include <QPoint>
+
+#include "ed/dockmenu/ed_menu_globals.h"
+
+namespace ed {
+
+/**
+ * Shared source of the global pointer position for the drag, drop and
+ * hover code.
+ *
+ * All reads during one event loop pass return the same position, so a
+ * drag frame costs at most one query of the window system. On X11 the
+ * query is an xcb_query_pointer request on a connection of its own. After
+ * a pass that read the position, the next request is sent right away, so
+ * the reply is usually waiting when the next mouse event is handled. A
+ * request still in flight is waited for instead of being sent again. A
+ * reply that already arrived is discarded and queried again only if it is
+ * older than maxReplyAgeMs() plus the measured round trip time, so on a
+ * remote display with long round trips the prefetched replies stay useful.
+ *
+ * On other platforms, or if device pixel scaling makes the native
+ * coordinates differ from Qt's, QCursor::pos() is used.
+ */
+class ED_EXPORT EPointerSource : public QObject {
+    Q_OBJECT
+
+public:
+    static EPointerSource& instance();
+    ~EPointerSource() override;
+
+    /**
+     * The global pointer position in device independent pixels
+     */
+    QPoint position();
+
+    /**
+     * Drops the cached position and a pending query, e.g. after
+     * QCursor::setPos()
+     */
+    void invalidate();
+
+    /**
+     * Sends a query now, if none is pending, to have the reply ready
+     * when position() is called later in this pass
+     */
+    void prefetch();
+
+    void setMaxReplyAgeMs(int ms);
+    int maxReplyAgeMs() const;
+
+    /**
+     * True if the position comes from the X server instead of QCursor
+     */
+    bool isNative() const;
+
+private Q_SLOTS:
+    void endOfPass();
+
+private:
+    explicit EPointerSource(QObject* parent = nullptr);
+    QPoint queryPosition();
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    QPoint waitForReply();
+#endif
+
+    inline static EPointerSource* m_instance = nullptr;
+
+    struct Private;
+    Private* d;
+};
+
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_POINTER_SOURCE_H
@@ -0,0 +1,239 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/RepaintHeatmap.h"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QPointer>
+#include <QStringList>
+#include <QTimer>
+#include <algorithm>
+
+#include "ed/dockmenu/MenuManager.h"
+
+namespace ed {
+
+namespace {
+const int FadeDurationMs = 1500;
+const int FadeIntervalMs = 33;
+const int MaxHeatmapEntries = 4096;
+const int LegendEntries = 5;
+
+struct HeatmapEntry {
+    QRect rect;  // in manager coordinates
+    qint64 timestamp;
+};
+
+struct RepaintTotal {
+    QPointer<QWidget> widget;
+    const char* className;
+    quintptr address;
+    qint64 area;
+
+    QString name() const {
+        return QString("%1 (%2)").arg(className, widget ? widget->objectName() : QString("deleted"));
+    }
+};
+}  // namespace
+
+struct ERepaintHeatmap::Private {
+    Private() = default;
+
+    QPointer<EMenuManager> menuManager;
+    QElapsedTimer clock;
+    QTimer* fadeTimer;
+    QList<HeatmapEntry> entries;
+    QHash<const QWidget*, RepaintTotal> areaTotals;
+    QList<RepaintTotal> deletedAreaTotals;  // moved out when the address is reused
+
+    QList<RepaintTotal> allAreaTotals() const {
+        return QList<RepaintTotal>(deletedAreaTotals) << areaTotals.values();
+    }
+};
+
+ERepaintHeatmap::ERepaintHeatmap(EMenuManager* manager) : QWidget(manager), d(new Private) {
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    setWindowFlags(Qt::Tool | Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint | Qt::X11BypassWindowManagerHint |
+                   Qt::WindowTransparentForInput);
+#else
+    setWindowFlags(Qt::Tool | Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint | Qt::WindowTransparentForInput);
+#endif
+    setWindowTitle("RepaintHeatmap");
+    setAttribute(Qt::WA_NoSystemBackground);
+    setAttribute(Qt::WA_TranslucentBackground);
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setAttribute(Qt::WA_ShowWithoutActivating);
+
+    d->menuManager = manager;
+    d->clock.start();
+    d->fadeTimer = new QTimer(this);
+    d->fadeTimer->setInterval(FadeIntervalMs);
+    connect(d->fadeTimer, &QTimer::timeout, this, &ERepaintHeatmap::onFadeTimeout);
+
+    qApp->installEventFilter(this);
+    updatePosition();
+    if (manager->isVisible()) {
+        show();
+    }
+}
+
+ERepaintHeatmap::~ERepaintHeatmap() {
+    qApp->removeEventFilter(this);
+    delete d;
+}
+
+QHash<QString, qint64> ERepaintHeatmap::repaintAreaTotals() const {
+    QHash<QString, qint64> totals;
+    for (const auto& total : d->allAreaTotals()) {
+        totals.insert(QString("%1 @0x%2").arg(total.name()).arg(total.address, 0, 16), total.area);
+    }
+    return totals;
+}
+
+void ERepaintHeatmap::resetRepaintAreaTotals() {
+    d->areaTotals.clear();
+    d->deletedAreaTotals.clear();
+}
+
+bool ERepaintHeatmap::isManagedWidget(QWidget* widget) const {
+    // Walk the parent chain manually, QWidget::isAncestorOf() stops at
+    // window boundaries and would miss the floating and tool windows
+    for (QWidget* w = widget; w != nullptr; w = w->parentWidget()) {
+        if (w == d->menuManager) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ERepaintHeatmap::eventFilter(QObject* watched, QEvent* event) {
+    if (d->menuManager.isNull() || !watched->isWidgetType()) {
+        return false;
+    }
+
+    QWidget* widget = static_cast<QWidget*>(watched);
+    switch (event->type()) {
+        case QEvent::Paint: {
+            if (widget == this || !isManagedWidget(widget)) {
+                break;
+            }
+
+            QRect rect = static_cast<QPaintEvent*>(event)->rect();
+            auto it = d->areaTotals.find(widget);
+            if (it != d->areaTotals.end() && it->widget.isNull()) {
+                d->deletedAreaTotals.append(*it);
+                d->areaTotals.erase(it);
+                it = d->areaTotals.end();
+            }
+            if (it == d->areaTotals.end()) {
+                it = d->areaTotals.insert(widget, {widget, widget->metaObject()->className(), quintptr(widget), 0});
+            }
+            it->area += qint64(rect.width()) * rect.height();
+
+            QPoint topLeft = d->menuManager->mapFromGlobal(widget->mapToGlobal(rect.topLeft()));
+            QRect mapped(topLeft, rect.size());
+            if (mapped.intersects(d->menuManager->rect()) && d->entries.count() < MaxHeatmapEntries) {
+                d->entries.append({mapped, d->clock.elapsed()});
+                if (!d->fadeTimer->isActive()) {
+                    d->fadeTimer->start();
+                }
+            }
+        } break;
+
+        case QEvent::Move:
+        case QEvent::Resize:
+        case QEvent::Show:
+        case QEvent::Hide:
+            if (widget == d->menuManager || widget == d->menuManager->window()) {
+                updatePosition();
+                setVisible(d->menuManager->isVisible());
+            }
+            break;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+void ERepaintHeatmap::updatePosition() {
+    if (d->menuManager.isNull()) {
+        return;
+    }
+    resize(d->menuManager->size());
+    move(d->menuManager->mapToGlobal(QPoint(0, 0)));
+}
+
+void ERepaintHeatmap::onFadeTimeout() {
+    const qint64 now = d->clock.elapsed();
+    d->entries.erase(std::remove_if(d->entries.begin(), d->entries.end(),
+                                    [now](const HeatmapEntry& entry) { return now - entry.timestamp > FadeDurationMs; }),
+                     d->entries.end());
+    if (d->entries.isEmpty()) {
+        d->fadeTimer->stop();
+    }
+    update();
+}
+
+void ERepaintHeatmap::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.setPen(Qt::NoPen);
+
+    // Overlapping rectangles add up, so often repainted areas glow brighter
+    const qint64 now = d->clock.elapsed();
+    for (const auto& entry : d->entries) {
+        qreal fade = 1.0 - qreal(now - entry.timestamp) / FadeDurationMs;
+        if (fade <= 0) {
+            continue;
+        }
+        painter.setBrush(QColor(255, 0, 0, int(60 * fade)));
+        painter.drawRect(entry.rect);
+    }
+
+    // Legend with the widgets that repainted the largest area
+    QList<RepaintTotal> totals = d->allAreaTotals();
+    std::sort(totals.begin(), totals.end(), [](const auto& a, const auto& b) { return a.area > b.area; });
+
+    QStringList lines;
+    for (int index = 0; index < qMin(LegendEntries, int(totals.count())); ++index) {
+        lines << QString("%1 px  %2").arg(totals[index].area).arg(totals[index].name());
+    }
+    if (lines.isEmpty()) {
+        return;
+    }
+
+    QRect textRect = painter.fontMetrics().boundingRect(QRect(0, 0, width(), height()), Qt::AlignLeft | Qt::AlignBottom,
+                                                        lines.join('\n'));
+    textRect.moveBottomRight(rect().bottomRight() - QPoint(4, 4));
+    painter.setBrush(QColor(0, 0, 0, 160));
+    painter.drawRect(textRect.adjusted(-4, -4, 4, 4));
+    painter.setPen(Qt::white);
+    painter.drawText(textRect, Qt::AlignLeft | Qt::AlignBottom, lines.join('\n'));
+}
+
+}  // namespace ed
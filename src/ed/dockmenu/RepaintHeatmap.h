@@ -0,0 +1,79 @@
+#ifndef ED_DOCKMENU_REPAINT_HEATMAP_H
+#define ED_DOCKMENU_REPAINT_HEATMAP_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QHash>
+#include <QWidget>
+
+#include "ed/dockmenu/ed_menu_globals.h"
+
+namespace ed {
+
+class EMenuManager;
+
+/**
+ * Debug layer that shows which areas of a menu manager are repainted.
+ * Every paint event of a widget inside the manager, including its floating
+ * and tool windows, adds its rectangle to a heatmap that fades out within
+ * 1.5 seconds and to a per widget total of repainted pixels.
+ *
+ * The layer is a separate transparent tool window like EMenuOverlay, so
+ * painting the heatmap does not repaint the widgets below it.
+ */
+class ED_EXPORT ERepaintHeatmap : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ERepaintHeatmap(EMenuManager* manager);
+    ~ERepaintHeatmap() override;
+
+    /**
+     * Repainted pixels per widget, keyed by "ClassName (objectName) @address".
+     * The totals are collected per widget instance, widgets with the same
+     * name are not merged. Deleted widgets keep their total until
+     * resetRepaintAreaTotals().
+     */
+    QHash<QString, qint64> repaintAreaTotals() const;
+    void resetRepaintAreaTotals();
+
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private Q_SLOTS:
+    void onFadeTimeout();
+
+private:
+    void updatePosition();
+    bool isManagedWidget(QWidget* widget) const;
+
+    struct Private;
+    Private* d;
+};
+
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_REPAINT_HEATMAP_H
@@ -23,10 +23,94 @@
 
 #include "ed/dockmenu/SlidingStacked.h"
 
-#include <QGraphicsOpacityEffect>
-#include <QPropertyAnimation>
+#include <QElapsedTimer>
+#include <QLayout>
+#include <QPainter>
+#include <QPixmap>
+#include <QResizeEvent>
+#include <QScreen>
+#include <QVariantAnimation>
+#include <algorithm>
+#include <cmath>
+
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
+
+namespace {
+/**
+ * Builds the statistics from the timestamps (ns) of the painted frames
+ */
+ETransitionStats transitionStatsFromFrames(const QList<qint64> &frameTimes, double expectedFrameMs) {
+    ETransitionStats stats;
+    stats.expectedFrameMs = expectedFrameMs;
+    if (frameTimes.count() < 2) {
+        stats.frameCount = frameTimes.count();
+        return stats;
+    }
+
+    QList<double> intervals;
+    intervals.reserve(frameTimes.count() - 1);
+    for (int index = 1; index < frameTimes.count(); ++index) {
+        double interval = (frameTimes[index] - frameTimes[index - 1]) / 1.0e6;
+        intervals.append(interval);
+        stats.avgFrameMs += interval;
+        stats.droppedFrames += qMax(0, qRound(interval / expectedFrameMs) - 1);
+    }
+    std::sort(intervals.begin(), intervals.end());
+
+    stats.frameCount = frameTimes.count();
+    stats.durationMs = (frameTimes.last() - frameTimes.first()) / 1.0e6;
+    stats.minFrameMs = intervals.first();
+    stats.maxFrameMs = intervals.last();
+    stats.avgFrameMs /= intervals.count();
+    stats.p99FrameMs = intervals[qMax(0, int(std::ceil(intervals.count() * 0.99)) - 1)];
+    return stats;
+}
+
+/**
+ * Paints both pages of a transition from snapshots in a single pass. The
+ * pages are grabbed once when the transition starts, so the cost of a frame
+ * does not depend on the content of the pages. The overlay is opaque, so
+ * the real pages below it are not painted while it is shown.
+ */
+class SlideSnapshotOverlay : public QWidget {
+public:
+    explicit SlideSnapshotOverlay(QWidget *parent) : QWidget(parent) {
+        setAttribute(Qt::WA_OpaquePaintEvent);
+        setAttribute(Qt::WA_TransparentForMouseEvents);
+        hide();
+    }
+
+    QPixmap nowPixmap;
+    QPixmap nextPixmap;
+    QPoint offset;           // distance the outgoing page moves until the end
+    qreal progress = 0;      // eased position of the pages
+    qreal timeFraction = 0;  // linear time, the pages fade within the first half
+
+    bool recordFrames = false;
+    QElapsedTimer frameClock;
+    QList<qint64> frameTimes;  // when each frame was painted
+
+protected:
+    void paintEvent(QPaintEvent *event) override {
+        Q_UNUSED(event);
+        if (recordFrames) {
+            frameTimes.append(frameClock.nsecsElapsed());
+        }
+        QPainter painter(this);
+        painter.fillRect(rect(), palette().window());
+
+        const QPointF nowPos = QPointF(offset) * progress;
+        const QPointF nextPos = -QPointF(offset) * (1.0 - progress);
+        painter.setOpacity(qMax(0.0, 1.0 - 2.0 * timeFraction));
+        painter.drawPixmap(nowPos, nowPixmap);
+        painter.setOpacity(qMin(1.0, 2.0 * timeFraction));
+        painter.drawPixmap(nextPos, nextPixmap);
+    }
+};
+}  // namespace
+
 struct ESlidingStacked::Private {
     Private() = default;
 
@@ -36,12 +120,15 @@ struct ESlidingStacked::Private {
     int m_next;
     bool m_wrap;
     bool m_active;
-    QPoint m_pnow;
 
     QWidget *mainWindow;
     QList<QWidget *> blockedPageList;
-    QParallelAnimationGroup *animGroup;
+    QVariantAnimation *animation = nullptr;
+    SlideSnapshotOverlay *overlay = nullptr;
     QEasingCurve::Type animationType;
+    EMenuStatistics *statistics = nullptr;
+
+    bool frameStatsEnabled = false;
 };
 
 ESlidingStacked::ESlidingStacked(QWidget *parent) : QStackedWidget(parent), d(new Private) {
@@ -57,7 +144,6 @@ ESlidingStacked::ESlidingStacked(QWidget *parent) : QStackedWidget(parent), d(ne
     d->m_now = 0;
     d->m_next = 0;
     d->m_wrap = false;
-    d->m_pnow = QPoint(0, 0);
     d->m_active = false;
 }
 
@@ -65,6 +151,18 @@ ESlidingStacked::~ESlidingStacked() {
     delete d;
 }
 
+void ESlidingStacked::setStatistics(EMenuStatistics *statistics) {
+    d->statistics = statistics;
+}
+
+void ESlidingStacked::setFrameStatsEnabled(bool enabled) {
+    d->frameStatsEnabled = enabled;
+}
+
+bool ESlidingStacked::frameStatsEnabled() const {
+    return d->frameStatsEnabled;
+}
+
 void ESlidingStacked::setSpeed(int speed) {
     d->m_speed = speed;
 }
@@ -111,7 +209,11 @@ void ESlidingStacked::slideInIdx(int idx, SlidingDirection direction) {
 }
 
 void ESlidingStacked::slideInWgt(QWidget *newWidget, SlidingDirection direction) {
+    ED_TRACE_SCOPE("slide", "ESlidingStacked::slideInWgt");
     if (d->m_active) {
+        if (d->statistics) {
+            d->statistics->slideAnimationsDropped++;
+        }
         return;
     } else {
         d->m_active = true;
@@ -149,66 +251,85 @@ void ESlidingStacked::slideInWgt(QWidget *newWidget, SlidingDirection direction)
         offsety = 0;
     }
 
-    QPoint pnext = widget(next)->pos();
-    QPoint pnow = widget(now)->pos();
-    d->m_pnow = pnow;
-    widget(next)->move(pnext.x() - offsetx, pnext.y() - offsety);
-
-    widget(next)->show();
-    widget(next)->raise();
-
-    QPropertyAnimation *animnow = new QPropertyAnimation(widget(now), "pos");
-    animnow->setDuration(d->m_speed);
-    animnow->setEasingCurve(d->animationType);
-    animnow->setStartValue(QPoint(pnow.x(), pnow.y()));
-    animnow->setEndValue(QPoint(offsetx + pnow.x(), offsety + pnow.y()));
-
-    QGraphicsOpacityEffect *animnow_op_eff = new QGraphicsOpacityEffect();
-    widget(now)->setGraphicsEffect(animnow_op_eff);
-    QPropertyAnimation *animnow_op = new QPropertyAnimation(animnow_op_eff, "opacity");
-    animnow_op->setDuration(d->m_speed / 2);
-    animnow_op->setStartValue(1);
-    animnow_op->setEndValue(0);
-    connect(animnow_op, &QPropertyAnimation::finished, [=]() {
-        if (animnow_op_eff != nullptr) animnow_op_eff->deleteLater();
-    });
-
-    QGraphicsOpacityEffect *animnext_op_eff = new QGraphicsOpacityEffect();
-    animnext_op_eff->setOpacity(0);
-    widget(next)->setGraphicsEffect(animnext_op_eff);
-    QPropertyAnimation *animnext_op = new QPropertyAnimation(animnext_op_eff, "opacity");
-    animnext_op->setDuration(d->m_speed / 2);
-    animnext_op->setStartValue(0);
-    animnext_op->setEndValue(1);
-    connect(animnext_op, &QPropertyAnimation::finished, [=]() {
-        if (animnext_op_eff != nullptr) animnext_op_eff->deleteLater();
-    });
-
-    QPropertyAnimation *animnext = new QPropertyAnimation(widget(next), "pos");
-    animnext->setDuration(d->m_speed);
-    animnext->setEasingCurve(d->animationType);
-    animnext->setStartValue(QPoint(-offsetx + pnext.x(), offsety + pnext.y()));
-    animnext->setEndValue(QPoint(pnext.x(), pnext.y()));
-
-    d->animGroup = new QParallelAnimationGroup;
-    d->animGroup->addAnimation(animnow);
-    d->animGroup->addAnimation(animnext);
-    d->animGroup->addAnimation(animnow_op);
-    d->animGroup->addAnimation(animnext_op);
-
-    QObject::connect(d->animGroup, SIGNAL(finished()), this, SLOT(animationDoneSlot()));
+    // Grab both pages once, the device pixel ratio of the window is kept by
+    // grab(). The incoming page is laid out for its grab while it is hidden.
+    QWidget *nextWidget = widget(next);
+    if (nextWidget->layout()) {
+        nextWidget->layout()->activate();
+    }
+    if (d->overlay == nullptr) {
+        d->overlay = new SlideSnapshotOverlay(this);
+    }
+    d->overlay->nowPixmap = widget(now)->grab();
+    d->overlay->nextPixmap = nextWidget->grab();
+    d->overlay->offset = QPoint(offsetx, offsety);
+    d->overlay->progress = 0;
+    d->overlay->timeFraction = 0;
+    d->overlay->frameTimes.clear();
+    d->overlay->recordFrames = d->frameStatsEnabled;
+    if (d->frameStatsEnabled) {
+        d->overlay->frameClock.start();
+    }
+    d->overlay->setGeometry(widget(now)->geometry());
+    d->overlay->raise();
+    d->overlay->show();
+
+    if (d->animation == nullptr) {
+        d->animation = new QVariantAnimation(this);
+        d->animation->setStartValue(0.0);
+        d->animation->setEndValue(1.0);
+        connect(d->animation, &QVariantAnimation::valueChanged, this, [this](const QVariant &value) {
+            d->overlay->progress = value.toReal();
+            d->overlay->timeFraction = d->animation->duration() > 0
+                                           ? qreal(d->animation->currentTime()) / d->animation->duration()
+                                           : 1.0;
+            d->overlay->update();
+        });
+        connect(d->animation, SIGNAL(finished()), this, SLOT(animationDoneSlot()));
+    }
+    d->animation->setDuration(d->m_speed);
+    d->animation->setEasingCurve(d->animationType);
+
     d->m_next = next;
     d->m_now = now;
     d->m_active = true;
-    d->animGroup->start(QAbstractAnimation::DeleteWhenStopped);
+    ED_TRACE_ASYNC_BEGIN("slide", "transition", this);
+    if (d->statistics) {
+        d->statistics->slideAnimationsStarted++;
+    }
+    d->animation->start();
+}
+
+void ESlidingStacked::resizeEvent(QResizeEvent *event) {
+    // The snapshots do not match the resized pages anymore
+    if (d->m_active && d->animation && d->animation->state() == QAbstractAnimation::Running) {
+        d->animation->stop();
+        animationDoneSlot();
+    }
+    QStackedWidget::resizeEvent(event);
 }
 
 void ESlidingStacked::animationDoneSlot() {
+    ED_TRACE_ASYNC_END("slide", "transition", this);
+    // The real incoming page is shown for the first time in the frame that
+    // removes the snapshots
     setCurrentIndex(d->m_next);
-    widget(d->m_now)->hide();
-    widget(d->m_now)->move(d->m_pnow);
+    d->overlay->hide();
+    d->overlay->nowPixmap = QPixmap();
+    d->overlay->nextPixmap = QPixmap();
+    d->overlay->recordFrames = false;
     d->m_active = false;
+    if (d->statistics) {
+        d->statistics->slideAnimationsCompleted++;
+    }
     emit animationFinished();
+
+    if (d->frameStatsEnabled && !d->overlay->frameTimes.isEmpty()) {
+        double refreshRate = screen() ? screen()->refreshRate() : 60.0;
+        ETransitionStats stats = transitionStatsFromFrames(d->overlay->frameTimes, 1000.0 / qMax(1.0, refreshRate));
+        d->overlay->frameTimes.clear();
+        emit transitionStats(stats);
+    }
 }
 
 }  // namespace ed
\ No newline at end of file
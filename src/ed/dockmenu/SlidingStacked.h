@@ -25,9 +25,9 @@
 //============================================================================
 
 #include <QEasingCurve>
-#include <QParallelAnimationGroup>
 #include <QStackedWidget>
 
+#include "ed/dockmenu/Diagnostics.h"
 #include "ed/dockmenu/ed_menu_globals.h"
 
 namespace ed {
@@ -47,6 +47,18 @@ public:
     explicit ESlidingStacked(QWidget* parent = nullptr);
     ~ESlidingStacked() override;
 
+    /**
+     * Counters of the owning manager, may be nullptr
+     */
+    void setStatistics(EMenuStatistics* statistics);
+
+    /**
+     * Records the frame intervals of every transition and emits
+     * transitionStats() when it finished. Disabled by default.
+     */
+    void setFrameStatsEnabled(bool enabled);
+    bool frameStatsEnabled() const;
+
 public Q_SLOTS:
     void setSpeed(int speed);
 
@@ -68,6 +80,12 @@ Q_SIGNALS:
     //! Animation is finished
     void animationFinished(void);
 
+    //! Frame statistics of the finished transition, see setFrameStatsEnabled()
+    void transitionStats(const ed::ETransitionStats& stats);
+
+protected:
+    void resizeEvent(QResizeEvent* event) override;
+
 protected Q_SLOTS:
     void animationDoneSlot(void);
 
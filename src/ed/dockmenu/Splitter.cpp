@@ -23,19 +23,91 @@
 
 #include "ed/dockmenu/Splitter.h"
 
+#include <QApplication>
 #include <QPainter>
+#include <algorithm>
 #include <cmath>
 
+#include "ed/dockmenu/Diagnostics.h"
 #include "ed/dockmenu/MouseTracker.h"
+#include "ed/dockmenu/Trace.h"
 
 namespace ed {
 
+namespace {
+// How close the mouse needs to be to a handle to trigger its visibility
+const int HandleProximity = 2;
+
+// Thickness of the hover highlight and of the enlarged hit area
+const int HoverThickness = 4;
+
+/**
+ * Highlight of a hovered handle. It lies on top of the splitter instead of
+ * widening the handle, so hovering repaints this widget only and does not
+ * relayout the panes. Mouse input is forwarded to the handle, which makes
+ * the highlight an enlarged hit area for dragging.
+ *
+ * QSplitter turns every child widget into a pane, so the overlay is a
+ * child of the window. The splitter's parent may be another splitter when
+ * splitters are nested.
+ */
+class HandleHoverOverlay : public QWidget {
+public:
+    HandleHoverOverlay(QSplitterHandle* handle, QWidget* parent) : QWidget(parent), m_handle(handle) {
+        setObjectName("ESplitterHandleHoverOverlay");
+        setAttribute(Qt::WA_NoSystemBackground);
+        setCursor(handle->orientation() == Qt::Horizontal ? Qt::SplitHCursor : Qt::SplitVCursor);
+        hide();
+    }
+
+    QColor color;
+
+protected:
+    void paintEvent(QPaintEvent* event) override {
+        Q_UNUSED(event);
+        QPainter painter(this);
+        painter.fillRect(rect(), color);
+    }
+
+    void mousePressEvent(QMouseEvent* event) override {
+        forward(event);
+    }
+
+    void mouseMoveEvent(QMouseEvent* event) override {
+        forward(event);
+    }
+
+    void mouseReleaseEvent(QMouseEvent* event) override {
+        forward(event);
+    }
+
+private:
+    void forward(QMouseEvent* event) {
+        const QPoint globalPos = internal::globalPositionOf(event);
+        QMouseEvent forwarded(event->type(), m_handle->mapFromGlobal(globalPos), globalPos, event->button(),
+                              event->buttons(), event->modifiers());
+        QApplication::sendEvent(m_handle, &forwarded);
+        event->setAccepted(forwarded.isAccepted());
+    }
+
+    QSplitterHandle* m_handle;
+};
+}  // namespace
+
 struct ESplitterHandle::Private {
     Private() = default;
 
     bool m_mousePressed = false;
     bool m_hover = false;
     QColor m_color;
+    QPointer<HandleHoverOverlay> m_hoverOverlay;
+
+    // Rate limited resizing, positions are left to right splitter
+    // coordinates like in QSplitterHandle::mouseMoveEvent()
+    QTimer m_resizeTimer;
+    int m_mouseOffset = 0;
+    int m_pendingPosition = 0;
+    bool m_resizePending = false;
 };
 
 ESplitterHandle::ESplitterHandle(Qt::Orientation orientation, QSplitter* parent)
@@ -45,16 +117,28 @@ ESplitterHandle::ESplitterHandle(Qt::Orientation orientation, QSplitter* parent)
     if (!d->m_color.isValid()) {
         d->m_color = QColor(0x3498db);
     }
+
+    // The first move of a drag is applied at once, the timer then applies
+    // the latest move of every interval
+    d->m_resizeTimer.setTimerType(Qt::PreciseTimer);
+    connect(&d->m_resizeTimer, &QTimer::timeout, this, [this]() {
+        if (!d->m_resizePending) {
+            d->m_resizeTimer.stop();
+            return;
+        }
+        applyPendingResize();
+    });
 }
 
 ESplitterHandle::~ESplitterHandle() {
-    ED_PRINT("ESplitterHandle::~ESplitterHandle()");
+    ED_TRACE_INSTANT("lifetime", "ESplitterHandle::~ESplitterHandle");
+    delete d->m_hoverOverlay;
     delete d;
 }
 
 QSize ESplitterHandle::sizeHint() const {
-    return d->m_hover ? (orientation() == Qt::Horizontal ? QSize(4, 0) : QSize(0, 4))
-                      : (orientation() == Qt::Horizontal ? QSize(1, 0) : QSize(0, 1));
+    // Independent of the hover state, hovering must not relayout the panes
+    return orientation() == Qt::Horizontal ? QSize(1, 0) : QSize(0, 1);
 }
 
 QColor ESplitterHandle::handleColor() const {
@@ -63,13 +147,20 @@ QColor ESplitterHandle::handleColor() const {
 
 void ESplitterHandle::setHandleColor(const QColor& Color) {
     d->m_color = Color;
+    if (d->m_hoverOverlay) {
+        d->m_hoverOverlay->color = Color;
+        d->m_hoverOverlay->update();
+    }
 }
 
 bool ESplitterHandle::setVisibleOnHover(bool hover) {
     if (d->m_hover != hover) {
         d->m_hover = hover;
-        updateGeometry();  // Important: tell layout to re-calculate size
-        update();          // Repaint
+        if (hover) {
+            updateHoverOverlayGeometry();
+        } else if (d->m_hoverOverlay) {
+            d->m_hoverOverlay->hide();
+        }
 
         return true;
     }
@@ -77,6 +168,46 @@ bool ESplitterHandle::setVisibleOnHover(bool hover) {
     return false;
 }
 
+void ESplitterHandle::updateHoverOverlayGeometry() {
+    QWidget* overlayParent = splitter()->window();
+    if (qobject_cast<QSplitter*>(overlayParent) != nullptr) {
+        return;
+    }
+
+    if (d->m_hoverOverlay == nullptr) {
+        d->m_hoverOverlay = new HandleHoverOverlay(this, overlayParent);
+        d->m_hoverOverlay->color = d->m_color;
+    } else if (d->m_hoverOverlay->parentWidget() != overlayParent) {
+        d->m_hoverOverlay->setParent(overlayParent);
+    }
+
+    QRect overlayRect(mapTo(overlayParent, QPoint(0, 0)), size());
+    if (orientation() == Qt::Horizontal) {
+        overlayRect.setLeft(overlayRect.center().x() - HoverThickness / 2 + 1);
+        overlayRect.setWidth(HoverThickness);
+    } else {
+        overlayRect.setTop(overlayRect.center().y() - HoverThickness / 2 + 1);
+        overlayRect.setHeight(HoverThickness);
+    }
+    d->m_hoverOverlay->setGeometry(overlayRect);
+    d->m_hoverOverlay->raise();
+    d->m_hoverOverlay->show();
+}
+
+void ESplitterHandle::moveEvent(QMoveEvent* event) {
+    QSplitterHandle::moveEvent(event);
+    if (d->m_hover) {
+        updateHoverOverlayGeometry();
+    }
+}
+
+void ESplitterHandle::resizeEvent(QResizeEvent* event) {
+    QSplitterHandle::resizeEvent(event);
+    if (d->m_hover) {
+        updateHoverOverlayGeometry();
+    }
+}
+
 bool ESplitterHandle::hovered() {
     return d->m_hover;
 }
@@ -88,16 +219,47 @@ bool ESplitterHandle::mousePressed() {
 void ESplitterHandle::mousePressEvent(QMouseEvent* event) {
     if (event->button() == Qt::LeftButton) {
         d->m_mousePressed = true;
+        d->m_mouseOffset = orientation() == Qt::Horizontal ? event->pos().x() : event->pos().y();
+        d->m_resizePending = false;
     }
     QSplitterHandle::mousePressEvent(event);
 }
 
+void ESplitterHandle::mouseMoveEvent(QMouseEvent* event) {
+    auto* splitter = qobject_cast<ESplitter*>(this->splitter());
+    if (!d->m_mousePressed || splitter == nullptr || splitter->resizeMode() != SplitterRateLimitedResize) {
+        QSplitterHandle::mouseMoveEvent(event);
+        return;
+    }
+
+    const QPoint pos = splitter->mapFromGlobal(internal::globalPositionOf(event));
+    d->m_pendingPosition = (orientation() == Qt::Horizontal ? pos.x() : pos.y()) - d->m_mouseOffset;
+    d->m_resizePending = true;
+    if (!d->m_resizeTimer.isActive()) {
+        applyPendingResize();
+        d->m_resizeTimer.start(1000 / std::max(1, splitter->maximumResizeRate()));
+    }
+}
+
 void ESplitterHandle::mouseReleaseEvent(QMouseEvent* event) {
+    // The base class applies the rubber band position of a ghost resize,
+    // dragFinished must see the final sizes
+    QSplitterHandle::mouseReleaseEvent(event);
     if (event->button() == Qt::LeftButton) {
         d->m_mousePressed = false;
+        d->m_resizeTimer.stop();
+        if (d->m_resizePending) {
+            applyPendingResize();
+        }
         Q_EMIT dragFinished();
     }
-    QSplitterHandle::mouseReleaseEvent(event);
+}
+
+void ESplitterHandle::applyPendingResize() {
+    // Mirrors the position for right to left layouts before it is passed
+    // to QSplitter::moveSplitter()
+    QSplitterHandle::moveSplitter(d->m_pendingPosition);
+    d->m_resizePending = false;
 }
 
 void ESplitterHandle::paintEvent(QPaintEvent* event) {
@@ -111,25 +273,134 @@ void ESplitterHandle::paintEvent(QPaintEvent* event) {
 
 ESplitter::ESplitter(Qt::Orientation orientation, QWidget* parent) : QSplitter(orientation, parent) {
     setMouseTracking(true);
-    QObject::connect(&MouseTracker::instance(), &MouseTracker::mouseMoved, this, &ESplitter::mouseMoved);
+    MouseTracker::instance().subscribe(this);
+    watchAncestors();
 }
 
 ESplitter::~ESplitter() {
-    ED_PRINT("ESplitter::~ESplitter()");
-    QObject::disconnect(&MouseTracker::instance(), &MouseTracker::mouseMoved, this, &ESplitter::mouseMoved);
+    ED_TRACE_INSTANT("lifetime", "ESplitter::~ESplitter");
+    MouseTracker::instance().unsubscribe(this);
+}
+
+void ESplitter::setStatistics(EMenuStatistics* statistics) {
+    m_statistics = statistics;
+}
+
+void ESplitter::setResizeMode(eSplitterResizeMode mode) {
+    m_resizeMode = mode;
+    setOpaqueResize(mode != SplitterGhostResize);
+}
+
+eSplitterResizeMode ESplitter::resizeMode() const {
+    return m_resizeMode;
+}
+
+void ESplitter::setMaximumResizeRate(int resizesPerSecond) {
+    m_maximumResizeRate = std::max(1, resizesPerSecond);
+}
+
+int ESplitter::maximumResizeRate() const {
+    return m_maximumResizeRate;
 }
 
 QSplitterHandle* ESplitter::createHandle() {
     auto* handle = new ESplitterHandle(orientation(), this);
+    handle->installEventFilter(this);
+    connect(handle, &ESplitterHandle::dragFinished, this, [this, handle]() {
+        const int index = indexOf(handle);
+        if (index != -1) {
+            Q_EMIT handleDragFinished(index);
+        }
+    });
+    m_handleIndexValid = false;
+    scheduleHotZoneUpdate();
     return handle;
 }
 
+void ESplitter::childEvent(QChildEvent* event) {
+    QSplitter::childEvent(event);
+    m_handleIndexValid = false;
+}
+
+void ESplitter::resizeEvent(QResizeEvent* event) {
+    QSplitter::resizeEvent(event);
+    m_handleIndexValid = false;
+}
+
+bool ESplitter::eventFilter(QObject* watched, QEvent* event) {
+    switch (event->type()) {
+        case QEvent::ParentChange:
+            watchAncestors();
+            scheduleHotZoneUpdate();
+            break;
+
+        case QEvent::Move:
+        case QEvent::Resize:
+        case QEvent::Show:
+        case QEvent::Hide:
+            if (watched != this && watched->parent() == this) {
+                m_handleIndexValid = false;
+            }
+            scheduleHotZoneUpdate();
+            break;
+
+        default:
+            break;
+    }
+    return QSplitter::eventFilter(watched, event);
+}
+
+void ESplitter::watchAncestors() {
+    for (const auto& ancestor : m_watchedAncestors) {
+        if (!ancestor.isNull()) {
+            ancestor->removeEventFilter(this);
+        }
+    }
+    m_watchedAncestors.clear();
+
+    // Moving the window keeps the window relative zones valid, only moves
+    // inside the window matter
+    for (QWidget* widget = this; widget != nullptr && !widget->isWindow(); widget = widget->parentWidget()) {
+        widget->installEventFilter(this);
+        m_watchedAncestors.append(widget);
+    }
+}
+
+void ESplitter::scheduleHotZoneUpdate() {
+    // A relayout moves all handles and ancestors at once, update once
+    if (!m_hotZoneUpdatePending) {
+        m_hotZoneUpdatePending = true;
+        QTimer::singleShot(0, this, &ESplitter::updateHotZones);
+    }
+}
+
+void ESplitter::updateHotZones() {
+    m_hotZoneUpdatePending = false;
+
+    QList<QRect> zones;
+    QWidget* topLevel = window();
+    for (int index = 1; index < this->count(); ++index) {
+        QSplitterHandle* handle = this->handle(index);
+        if (handle == nullptr || !handle->isVisibleTo(this)) {
+            continue;
+        }
+
+        QRect zone = handle->geometry().adjusted(-HandleProximity, -HandleProximity, HandleProximity, HandleProximity);
+        zones.append(QRect(mapTo(topLevel, zone.topLeft()), zone.size()));
+    }
+
+    MouseTracker::instance().setHotZones(this, zones, [this](const QPoint& pos) { mouseMoved(pos); });
+}
+
 void ESplitter::mouseMoveEvent(QMouseEvent* event) {
     QSplitter::mouseMoveEvent(event);
     updateHandleVisibility(false, event->pos());
 }
 
 void ESplitter::mouseMoved(const QPoint& mousePos) {
+    if (m_statistics) {
+        m_statistics->mouseTrackerTicks++;
+    }
     QPoint localPos = mapFromGlobal(mousePos);
     updateHandleVisibility(true, localPos);
 }
@@ -139,40 +410,72 @@ void ESplitter::showEvent(QShowEvent* event) {
     Q_EMIT splitterReady();
 }
 
-void ESplitter::updateHandleVisibility(bool timerEvent, const QPoint& mousePos) {
-    bool update = false;
-    for (int index = 1; index < this->count(); ++index) {
-        ESplitterHandle* handle = static_cast<ESplitterHandle*>(this->handle(index));
-        if (handle && handle->mousePressed()) {
-            return;
+void ESplitter::rebuildHandleIndex() const {
+    m_handleIndex.clear();
+    const bool horizontal = orientation() == Qt::Horizontal;
+    for (int index = 0; index < count(); ++index) {
+        auto* handle = static_cast<ESplitterHandle*>(this->handle(index));
+        if (handle == nullptr || handle->isHidden()) {
+            continue;
         }
+
+        const QRect zone =
+            handle->geometry().adjusted(-HandleProximity, -HandleProximity, HandleProximity, HandleProximity);
+        m_handleIndex.append({horizontal ? zone.left() : zone.top(), zone, handle});
     }
 
-    for (int index = 1; index < this->count(); ++index) {
-        ESplitterHandle* handle = static_cast<ESplitterHandle*>(this->handle(index));
-        if (handle == nullptr) {
-            continue;
-        }
+    // Handles are in pane order, which is their geometric order unless the
+    // layout direction is right to left
+    std::sort(m_handleIndex.begin(), m_handleIndex.end(),
+              [](const HandleZone& a, const HandleZone& b) { return a.start < b.start; });
+    m_handleIndexValid = true;
+}
 
-        if (timerEvent) {
-            if (!handle->hovered()) {
-                continue;
-            }
-        }
+ESplitterHandle* ESplitter::handleAt(const QPoint& pos) const {
+    if (!m_handleIndexValid) {
+        rebuildHandleIndex();
+    }
 
-        QRect handleRect = handle->geometry();
-        int proximity = 2;  // How close mouse needs to be to trigger visibility
-        QRect hoverZone = handleRect.adjusted(-proximity, -proximity, proximity, proximity);
-        update = handle->setVisibleOnHover(hoverZone.contains(mousePos));
-        if (update) {
-            handle->setCursor(orientation() == Qt::Horizontal ? Qt::SplitHCursor : Qt::SplitVCursor);
-            break;
-        }
+    // All zones have the same extent, so only the last zone starting at or
+    // before pos can contain it, even if zones of collapsed panes overlap
+    const int position = orientation() == Qt::Horizontal ? pos.x() : pos.y();
+    auto it = std::upper_bound(m_handleIndex.cbegin(), m_handleIndex.cend(), position,
+                               [](int value, const HandleZone& zone) { return value < zone.start; });
+    if (it == m_handleIndex.cbegin()) {
+        return nullptr;
+    }
+
+    --it;
+    return it->zone.contains(pos) ? it->handle : nullptr;
+}
+
+void ESplitter::updateHandleVisibility(bool timerEvent, const QPoint& mousePos) {
+    if (m_hoveredHandle && m_hoveredHandle->mousePressed()) {
+        return;
+    }
+
+    ESplitterHandle* handle = handleAt(mousePos);
+    // Tracker positions only end a hover, it starts with a mouse move over
+    // the splitter
+    if (timerEvent && handle != m_hoveredHandle) {
+        handle = nullptr;
+    }
+    if (handle == m_hoveredHandle) {
+        return;
+    }
+
+    bool update = false;
+    if (m_hoveredHandle) {
+        update = m_hoveredHandle->setVisibleOnHover(false);
+    }
+    m_hoveredHandle = handle;
+    if (handle) {
+        update = handle->setVisibleOnHover(true) || update;
+        handle->setCursor(orientation() == Qt::Horizontal ? Qt::SplitHCursor : Qt::SplitVCursor);
     }
 
-    if (update) {
-        // Force layout update to respect new sizeHints
-        updateGeometry();
+    if (update && m_statistics) {
+        m_statistics->splitterHoverChanges++;
     }
 }
 
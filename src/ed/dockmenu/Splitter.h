@@ -25,14 +25,18 @@
 //============================================================================
 
 #include <QMouseEvent>
+#include <QPointer>
 #include <QSplitter>
 #include <QSplitterHandle>
 #include <QTimer>
+#include <QVector>
 
 #include "ed/dockmenu/ed_menu_globals.h"
 
 namespace ed {
 
+struct EMenuStatistics;
+
 class ESplitterHandle : public QSplitterHandle {
     Q_OBJECT
     Q_PROPERTY(QColor handleColor READ handleColor WRITE setHandleColor)
@@ -53,13 +57,19 @@ Q_SIGNALS:
 protected:
     void paintEvent(QPaintEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
     void mouseReleaseEvent(QMouseEvent* event) override;
+    void moveEvent(QMoveEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
 
 protected:
     QColor handleColor() const;
     void setHandleColor(const QColor& Color);
 
 private:
+    void updateHoverOverlayGeometry();
+    void applyPendingResize();
+
     struct Private;
     Private* d;
 };
@@ -71,8 +81,45 @@ public:
     ESplitter(Qt::Orientation orientation, QWidget* parent = nullptr);
     ~ESplitter() override;
 
+    /**
+     * Counters of the owning manager, may be nullptr
+     */
+    void setStatistics(EMenuStatistics* statistics);
+
+    /**
+     * How dragging a handle resizes the widgets. SplitterGhostResize uses
+     * the rubber band of QSplitter, SplitterRateLimitedResize applies at
+     * most maximumResizeRate() resizes per second and always the last
+     * position. The default is SplitterOpaqueResize.
+     */
+    void setResizeMode(eSplitterResizeMode mode);
+    eSplitterResizeMode resizeMode() const;
+
+    /**
+     * Resizes per second of SplitterRateLimitedResize, 30 by default
+     */
+    void setMaximumResizeRate(int resizesPerSecond);
+    int maximumResizeRate() const;
+
+    /**
+     * Watches the handles and the ancestors of the splitter to keep its
+     * MouseTracker hot zones and its handle index in sync with the handle
+     * geometries
+     */
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+    /**
+     * Visible handle whose hover zone contains pos, in splitter coordinates.
+     * A binary search in the handle index, which is rebuilt after the
+     * splitter or one of its handles was resized, moved or a child was
+     * added or removed.
+     */
+    ESplitterHandle* handleAt(const QPoint& pos) const;
+
 protected:
     QSplitterHandle* createHandle() override;
+    void childEvent(QChildEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
 
     void mouseMoveEvent(QMouseEvent* event) override;
     void updateHandleVisibility(bool timerEvent, const QPoint& mousePos);
@@ -81,8 +128,38 @@ protected:
 Q_SIGNALS:
     void splitterReady();
 
+    /**
+     * A drag of the handle at index finished, the handle lies before the
+     * widget at index
+     */
+    void handleDragFinished(int index);
+
 private Q_SLOTS:
     void mouseMoved(const QPoint& mousePos);
+    void updateHotZones();
+
+private:
+    void watchAncestors();
+    void scheduleHotZoneUpdate();
+    void rebuildHandleIndex() const;
+
+    /**
+     * Hover zone of a visible handle, sorted by start along the orientation
+     */
+    struct HandleZone {
+        int start;
+        QRect zone;
+        ESplitterHandle* handle;
+    };
+
+    EMenuStatistics* m_statistics = nullptr;
+    eSplitterResizeMode m_resizeMode = SplitterOpaqueResize;
+    int m_maximumResizeRate = 30;
+    QList<QPointer<QWidget>> m_watchedAncestors;
+    bool m_hotZoneUpdatePending = false;
+    mutable QVector<HandleZone> m_handleIndex;
+    mutable bool m_handleIndexValid = false;
+    QPointer<ESplitterHandle> m_hoveredHandle;
 };
 }  // namespace ed
 
@@ -0,0 +1,228 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/SplitterTransition.h"
+
+#include <QCoreApplication>
+#include <QEasingCurve>
+#include <QPainter>
+#include <QPixmap>
+#include <QPointer>
+#include <QSplitter>
+#include <QVariantAnimation>
+
+#include "ed/dockmenu/Trace.h"
+
+namespace ed {
+
+namespace {
+const int DefaultDurationMs = 200;
+
+struct PaneSnapshot {
+    QRect from;
+    QRect to;
+    QPixmap pixmap;
+};
+
+QRect interpolate(const QRect& from, const QRect& to, qreal progress) {
+    auto mix = [progress](int a, int b) { return a + qRound((b - a) * progress); };
+    return QRect(QPoint(mix(from.left(), to.left()), mix(from.top(), to.top())),
+                 QPoint(mix(from.right(), to.right()), mix(from.bottom(), to.bottom())));
+}
+}  // namespace
+
+struct ESplitterTransition::Private {
+    QPointer<QSplitter> splitter;
+    QVariantAnimation* animation = nullptr;
+    QList<PaneSnapshot> panes;
+};
+
+ESplitterTransition::ESplitterTransition(QSplitter* splitter, QWidget* parent) : QWidget(parent), d(new Private) {
+    d->splitter = splitter;
+    setObjectName("ESplitterTransition");
+
+    // Opaque, so the panes below are not painted while they are covered
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    hide();
+
+    d->animation = new QVariantAnimation(this);
+    d->animation->setStartValue(0.0);
+    d->animation->setEndValue(1.0);
+    d->animation->setDuration(DefaultDurationMs);
+    d->animation->setEasingCurve(QEasingCurve::OutCubic);
+    connect(d->animation, &QVariantAnimation::valueChanged, this, [this]() { update(); });
+    connect(d->animation, &QVariantAnimation::finished, this, &ESplitterTransition::finish);
+
+    splitter->installEventFilter(this);
+}
+
+ESplitterTransition::~ESplitterTransition() {
+    delete d;
+}
+
+void ESplitterTransition::setDuration(int msecs) {
+    d->animation->setDuration(msecs);
+}
+
+int ESplitterTransition::duration() const {
+    return d->animation->duration();
+}
+
+void ESplitterTransition::start(const QList<int>& sizes) {
+    ED_TRACE_SCOPE("menu", "ESplitterTransition::start");
+    finish();
+
+    QSplitter* splitter = d->splitter;
+    if (splitter == nullptr) {
+        return;
+    }
+
+    if (!splitter->isVisible() || splitter->count() != sizes.count() || d->animation->duration() <= 0) {
+        splitter->setSizes(sizes);
+        return;
+    }
+
+    const bool horizontal = splitter->orientation() == Qt::Horizontal;
+    const QList<int> currentSizes = splitter->sizes();
+    QList<PaneSnapshot> panes;
+    for (int index = 0; index < splitter->count(); ++index) {
+        PaneSnapshot pane;
+        QWidget* widget = splitter->widget(index);
+        pane.from = widget->isVisible() ? widget->geometry() : QRect();
+        if (sizes[index] < currentSizes[index] && !pane.from.isEmpty()) {
+            pane.pixmap = widget->grab();
+        }
+        panes.append(pane);
+    }
+
+    // Cover the splitter before the relayout, it is not painted until the
+    // snapshots move away
+    updatePosition();
+    raise();
+    show();
+
+    splitter->setSizes(sizes);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::LayoutRequest);
+
+    bool changed = false;
+    for (int index = 0; index < panes.count(); ++index) {
+        PaneSnapshot& pane = panes[index];
+        QWidget* widget = splitter->widget(index);
+        pane.to = widget->isVisible() ? widget->geometry() : QRect();
+        if (pane.pixmap.isNull() && !pane.to.isEmpty()) {
+            pane.pixmap = widget->grab();
+        }
+        // Collapsed panes keep their position, only their extent changes
+        if (pane.from.isEmpty()) {
+            pane.from = horizontal ? QRect(pane.to.left(), pane.to.top(), 0, pane.to.height())
+                                   : QRect(pane.to.left(), pane.to.top(), pane.to.width(), 0);
+        }
+        if (pane.to.isEmpty()) {
+            pane.to = horizontal ? QRect(pane.from.left(), pane.from.top(), 0, pane.from.height())
+                                 : QRect(pane.from.left(), pane.from.top(), pane.from.width(), 0);
+        }
+        changed = changed || pane.from != pane.to;
+    }
+
+    if (!changed) {
+        hide();
+        return;
+    }
+
+    d->panes = panes;
+    d->animation->start();
+}
+
+void ESplitterTransition::finish() {
+    if (d->panes.isEmpty()) {
+        return;
+    }
+
+    d->animation->stop();
+    d->panes.clear();
+    hide();
+    Q_EMIT finished();
+}
+
+bool ESplitterTransition::isRunning() const {
+    return !d->panes.isEmpty();
+}
+
+bool ESplitterTransition::eventFilter(QObject* watched, QEvent* event) {
+    if (watched == d->splitter && isRunning()) {
+        switch (event->type()) {
+            case QEvent::Move:
+                updatePosition();
+                break;
+
+            // The snapshots do not match a resized splitter anymore
+            case QEvent::Resize:
+            case QEvent::Hide:
+            case QEvent::ParentChange:
+                finish();
+                break;
+
+            default:
+                break;
+        }
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+void ESplitterTransition::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().window());
+
+    const bool horizontal = d->splitter && d->splitter->orientation() == Qt::Horizontal;
+    const qreal progress = d->animation->currentValue().toReal();
+    for (const auto& pane : d->panes) {
+        const QRect paneRect = interpolate(pane.from, pane.to, progress);
+        if (paneRect.isEmpty() || pane.pixmap.isNull()) {
+            continue;
+        }
+
+        // The snapshot sticks to the edge that moves, so it slides with the
+        // splitter handle instead of being cut off
+        const QSize pixmapSize = pane.pixmap.size() / pane.pixmap.devicePixelRatio();
+        QPoint origin = paneRect.topLeft();
+        if (horizontal && pane.from.left() == pane.to.left()) {
+            origin.setX(paneRect.right() + 1 - pixmapSize.width());
+        } else if (!horizontal && pane.from.top() == pane.to.top()) {
+            origin.setY(paneRect.bottom() + 1 - pixmapSize.height());
+        }
+
+        painter.save();
+        painter.setClipRect(paneRect);
+        painter.drawPixmap(origin, pane.pixmap);
+        painter.restore();
+    }
+}
+
+void ESplitterTransition::updatePosition() {
+    if (d->splitter) {
+        setGeometry(d->splitter->geometry());
+    }
+}
+
+}  // namespace ed
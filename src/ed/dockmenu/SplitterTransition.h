@@ -0,0 +1,92 @@
+#ifndef ED_DOCKMENU_SPLITTER_TRANSITION_H
+#define ED_DOCKMENU_SPLITTER_TRANSITION_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QList>
+#include <QWidget>
+
+#include "ed/dockmenu/ed_menu_globals.h"
+
+class QSplitter;
+
+namespace ed {
+
+/**
+ * Animates a splitter to new sizes with snapshots of its panes.
+ *
+ * start() covers the splitter with this widget, applies the new sizes at
+ * once and lets the pending layouts run, so the panes are relaid out
+ * exactly once and behind the cover. Until the animation ends only the
+ * snapshots move, which keeps the frame rate independent of the content of
+ * the panes. Every pane is shown with the snapshot of its larger state,
+ * taken before the relayout if it shrinks and after it if it grows.
+ *
+ * QSplitter turns every child widget into a pane, so the widget is a child
+ * of the splitter's parent.
+ */
+class ED_EXPORT ESplitterTransition : public QWidget {
+    Q_OBJECT
+
+public:
+    ESplitterTransition(QSplitter* splitter, QWidget* parent);
+    ~ESplitterTransition() override;
+
+    /**
+     * Duration of a transition in milliseconds, 200 by default
+     */
+    void setDuration(int msecs);
+    int duration() const;
+
+    /**
+     * Resizes the panes of the splitter to sizes. A running transition is
+     * finished first. Sets the sizes without animation if the splitter is
+     * hidden.
+     */
+    void start(const QList<int>& sizes);
+
+    /**
+     * Ends a running transition and reveals the real panes
+     */
+    void finish();
+    bool isRunning() const;
+
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+Q_SIGNALS:
+    void finished();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    void updatePosition();
+
+    struct Private;
+    Private* d;
+};
+
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_SPLITTER_TRANSITION_H
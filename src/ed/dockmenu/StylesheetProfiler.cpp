@@ -0,0 +1,183 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/StylesheetProfiler.h"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QRegularExpression>
+#include <QSet>
+#include <QWidget>
+#include <algorithm>
+
+namespace ed {
+
+namespace {
+/**
+ * Collects the widgets of a subtree that receive a style change while
+ * installed on the application
+ */
+class StyleChangeCounter : public QObject {
+public:
+    explicit StyleChangeCounter(QWidget* root) : m_root(root) {
+        qApp->installEventFilter(this);
+    }
+
+    ~StyleChangeCounter() override {
+        qApp->removeEventFilter(this);
+    }
+
+    int count() const {
+        return m_widgets.count();
+    }
+
+    bool eventFilter(QObject* watched, QEvent* event) override {
+        if (event->type() == QEvent::StyleChange && watched->isWidgetType()) {
+            QWidget* widget = static_cast<QWidget*>(watched);
+            if (widget == m_root || m_root->isAncestorOf(widget)) {
+                m_widgets.insert(widget);
+            }
+        }
+        return false;
+    }
+
+private:
+    QWidget* m_root;
+    QSet<QObject*> m_widgets;
+};
+
+qint64 applyStyleSheet(QWidget* widget, const QString& styleSheet) {
+    QElapsedTimer timer;
+    timer.start();
+    widget->setStyleSheet(styleSheet);
+    return timer.nsecsElapsed();
+}
+}  // namespace
+
+EStylesheetProfile EStylesheetProfiler::profile(QWidget* widget, const QString& styleSheet) {
+    EStylesheetProfile profile;
+
+    QList<QWidget*> subtree = widget->findChildren<QWidget*>();
+    subtree.prepend(widget);
+    profile.widgetsInSubtree = subtree.count();
+
+    {
+        StyleChangeCounter counter(widget);
+        profile.applyNs = applyStyleSheet(widget, styleSheet);
+        profile.widgetsPolished = counter.count();
+    }
+
+    const auto rules = parseRules(styleSheet);
+    QStringList selectors;
+    for (const auto& rule : rules) {
+        if (!selectors.contains(rule.first)) {
+            selectors << rule.first;
+        }
+    }
+
+    for (const QString& selector : selectors) {
+        EStyleRuleCost cost;
+        cost.selector = selector;
+
+        QString reduced;
+        for (const auto& rule : rules) {
+            if (rule.first == selector) {
+                cost.rules++;
+            } else {
+                reduced += rule.first + " " + rule.second + "\n";
+            }
+        }
+
+        for (QWidget* subtreeWidget : subtree) {
+            if (matches(subtreeWidget, selector)) {
+                cost.matchedWidgets++;
+            }
+        }
+
+        // Reapply the whole stylesheet right before, so both measurements
+        // start from the same state
+        const qint64 fullNs = applyStyleSheet(widget, styleSheet);
+        const qint64 reducedNs = applyStyleSheet(widget, reduced);
+        cost.costNs = qMax<qint64>(0, fullNs - reducedNs);
+        profile.rules.append(cost);
+    }
+
+    widget->setStyleSheet(styleSheet);
+
+    std::sort(profile.rules.begin(), profile.rules.end(),
+              [](const EStyleRuleCost& a, const EStyleRuleCost& b) { return a.costNs > b.costNs; });
+    return profile;
+}
+
+QList<QPair<QString, QString>> EStylesheetProfiler::parseRules(const QString& styleSheet) {
+    static const QRegularExpression comments("/\\*.*?\\*/", QRegularExpression::DotMatchesEverythingOption);
+    QString sheet = styleSheet;
+    sheet.remove(comments);
+
+    QList<QPair<QString, QString>> rules;
+    int position = 0;
+    while (true) {
+        const int open = sheet.indexOf('{', position);
+        if (open < 0) {
+            break;
+        }
+        const int close = sheet.indexOf('}', open);
+        if (close < 0) {
+            break;
+        }
+
+        const QString selector = sheet.mid(position, open - position).simplified();
+        if (!selector.isEmpty()) {
+            rules.append({selector, sheet.mid(open, close - open + 1)});
+        }
+        position = close + 1;
+    }
+    return rules;
+}
+
+bool EStylesheetProfiler::matches(const QWidget* widget, const QString& selector) {
+    static const QRegularExpression compound("^([A-Za-z_][\\w-]*)?(?:#([\\w-]+))?");
+
+    for (const QString& part : selector.split(',')) {
+        const QStringList compounds = part.simplified().split(QRegularExpression("\\s*[ >]\\s*"));
+        const QRegularExpressionMatch match = compound.match(compounds.last());
+        QString typeName = match.captured(1);
+        const QString objectName = match.captured(2);
+        if (typeName.isEmpty() && objectName.isEmpty()) {
+            continue;
+        }
+
+        // Stylesheets write namespaces with "--" instead of "::"
+        typeName.replace("--", "::");
+        if (!typeName.isEmpty() && !widget->inherits(typeName.toLatin1().constData())) {
+            continue;
+        }
+        if (!objectName.isEmpty() && widget->objectName() != objectName) {
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+}  // namespace ed
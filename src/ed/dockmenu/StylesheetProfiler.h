@@ -0,0 +1,67 @@
+#ifndef ED_DOCKMENU_STYLESHEET_PROFILER_H
+#define ED_DOCKMENU_STYLESHEET_PROFILER_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QList>
+#include <QPair>
+#include <QString>
+
+#include "ed/dockmenu/Diagnostics.h"
+#include "ed/dockmenu/ed_menu_globals.h"
+
+class QWidget;
+
+namespace ed {
+
+/**
+ * Measures what a stylesheet costs when it is applied to a widget subtree.
+ *
+ * The whole stylesheet is applied once to measure the total polish time and
+ * to count the polished widgets. Then the rules of every selector are left
+ * out in turn to get their share of the time. Each of these steps repolishes
+ * the whole subtree, so profiling takes a multiple of a normal apply. The
+ * given stylesheet is set again at the end.
+ */
+class ED_EXPORT EStylesheetProfiler {
+public:
+    static EStylesheetProfile profile(QWidget* widget, const QString& styleSheet);
+
+    /**
+     * Splits a stylesheet into (selector, rule block) pairs, comments are
+     * removed
+     */
+    static QList<QPair<QString, QString>> parseRules(const QString& styleSheet);
+
+    /**
+     * True if the widget matches the type and object name of the last
+     * compound selector of one of the comma separated selectors.
+     * Pseudo states, attributes and combinators are ignored.
+     */
+    static bool matches(const QWidget* widget, const QString& selector);
+};
+
+}  // namespace ed
+
+#endif  // ED_DOCKMENU_STYLESHEET_PROFILER_H
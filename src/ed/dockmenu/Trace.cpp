@@ -0,0 +1,201 @@
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include "ed/dockmenu/Trace.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QThread>
+#include <QVector>
+
+namespace ed {
+
+namespace {
+/**
+ * Upper bound for the number of buffered events. With sizeof(TraceEvent)
+ * of 56 bytes on 64 bit platforms the buffer holds at most 56 MiB.
+ * Recording stops silently once it is reached.
+ */
+const int MaxTraceEvents = 1 << 20;
+
+struct TraceEvent {
+    const char* category;
+    const char* name;
+    char phase;
+    qint64 timestamp;
+    qint64 duration;
+    quintptr id;
+    quintptr threadId;
+};
+
+void appendEscaped(QByteArray& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out.append('\\');
+        }
+        out.append(*c);
+    }
+}
+}  // namespace
+
+struct ETraceSink::Private {
+    Private() = default;
+
+    bool enabled = false;
+    QElapsedTimer clock;
+    QVector<TraceEvent> events;
+    QString outputFile;
+
+    void append(const char* category, const char* name, char phase, qint64 timestamp, qint64 duration,
+                quintptr id) {
+        if (events.size() >= MaxTraceEvents) {
+            return;
+        }
+        events.append(
+            {category, name, phase, timestamp, duration, id, reinterpret_cast<quintptr>(QThread::currentThreadId())});
+    }
+};
+
+ETraceSink::ETraceSink() : d(new Private) {
+    d->clock.start();
+
+    d->outputFile = qEnvironmentVariable("ED_DOCKMENU_TRACE");
+    if (!d->outputFile.isEmpty()) {
+        d->enabled = true;
+        if (QCoreApplication::instance()) {
+            QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit,
+                             [this]() { this->writeJson(d->outputFile); });
+        }
+    }
+}
+
+ETraceSink::~ETraceSink() {
+    delete d;
+}
+
+ETraceSink& ETraceSink::instance() {
+    if (!m_instance) {
+        m_instance = new ETraceSink();
+    }
+    return *m_instance;
+}
+
+void ETraceSink::setEnabled(bool enabled) {
+    d->enabled = enabled;
+}
+
+bool ETraceSink::isEnabled() const {
+    return d->enabled;
+}
+
+void ETraceSink::clear() {
+    d->events.clear();
+}
+
+int ETraceSink::eventCount() const {
+    return d->events.size();
+}
+
+qint64 ETraceSink::now() const {
+    return d->clock.nsecsElapsed();
+}
+
+void ETraceSink::completeEvent(const char* category, const char* name, qint64 startNs) {
+    if (d->enabled) {
+        d->append(category, name, 'X', startNs, now() - startNs, 0);
+    }
+}
+
+void ETraceSink::instantEvent(const char* category, const char* name) {
+    if (d->enabled) {
+        d->append(category, name, 'i', now(), 0, 0);
+    }
+}
+
+void ETraceSink::asyncBegin(const char* category, const char* name, const void* id) {
+    if (d->enabled) {
+        d->append(category, name, 'b', now(), 0, reinterpret_cast<quintptr>(id));
+    }
+}
+
+void ETraceSink::asyncEnd(const char* category, const char* name, const void* id) {
+    if (d->enabled) {
+        d->append(category, name, 'e', now(), 0, reinterpret_cast<quintptr>(id));
+    }
+}
+
+QByteArray ETraceSink::toJson() const {
+    const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+
+    QByteArray out;
+    out.reserve(d->events.size() * 128 + 64);
+    out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    for (int index = 0; index < d->events.size(); ++index) {
+        const TraceEvent& event = d->events.at(index);
+        if (index > 0) {
+            out.append(",\n");
+        }
+
+        out.append("{\"cat\":\"");
+        appendEscaped(out, event.category);
+        out.append("\",\"name\":\"");
+        appendEscaped(out, event.name);
+        out.append("\",\"ph\":\"").append(event.phase);
+        out.append("\",\"ts\":").append(QByteArray::number(event.timestamp / 1000.0, 'f', 3));
+        out.append(",\"pid\":").append(pid);
+        out.append(",\"tid\":").append(QByteArray::number(quint64(event.threadId)));
+
+        switch (event.phase) {
+            case 'X':
+                out.append(",\"dur\":").append(QByteArray::number(event.duration / 1000.0, 'f', 3));
+                break;
+            case 'i':
+                out.append(",\"s\":\"t\"");
+                break;
+            case 'b':
+            case 'e':
+                out.append(",\"id\":\"0x").append(QByteArray::number(quint64(event.id), 16)).append('"');
+                break;
+            default:
+                break;
+        }
+        out.append('}');
+    }
+
+    out.append("]}\n");
+    return out;
+}
+
+bool ETraceSink::writeJson(const QString& fileName) const {
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "ETraceSink: cannot write trace to" << fileName;
+        return false;
+    }
+    file.write(toJson());
+    return true;
+}
+
+}  // namespace ed
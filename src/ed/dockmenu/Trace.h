@@ -0,0 +1,147 @@
+#ifndef ED_DOCKMENU_TRACE_H
+#define ED_DOCKMENU_TRACE_H
+
+/*******************************************************************************
+** Qt Dock Menu System
+** Copyright (C) 2025 ED Trading
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 3.0 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+//============================================================================
+/// \author Phuoc Truong
+/// \date   17.10.2026
+//============================================================================
+
+#include <QByteArray>
+#include <QString>
+
+#include "ed/dockmenu/ed_menu_globals.h"
+
+namespace ed {
+
+/**
+ * Collects trace events in the Chrome trace event format, which can be
+ * loaded into chrome://tracing or https://ui.perfetto.dev.
+ *
+ * The library only records events if it is built with ED_DOCKMENU_TRACING
+ * (CMake option ED_ENABLE_TRACING). Without it the ED_TRACE_* macros expand
+ * to nothing. Recording starts when setEnabled(true) is called or when the
+ * environment variable ED_DOCKMENU_TRACE names an output file. In the latter
+ * case the trace is written when the application quits.
+ *
+ * All events must be recorded from the GUI thread.
+ */
+class ED_EXPORT ETraceSink {
+public:
+    static ETraceSink& instance();
+
+    ~ETraceSink();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * Removes all recorded events
+     */
+    void clear();
+
+    /**
+     * Number of recorded events
+     */
+    int eventCount() const;
+
+    /**
+     * Monotonic timestamp in nanoseconds used for all events
+     */
+    qint64 now() const;
+
+    /**
+     * Records a complete event ("X") that started at startNs
+     */
+    void completeEvent(const char* category, const char* name, qint64 startNs);
+
+    /**
+     * Records an instant event ("i")
+     */
+    void instantEvent(const char* category, const char* name);
+
+    /**
+     * Records the begin ("b") or the end ("e") of an asynchronous span. The
+     * id connects both ends, so spans that cross several events, like a drag
+     * or a slide animation, show up as one bar in the trace viewer.
+     */
+    void asyncBegin(const char* category, const char* name, const void* id);
+    void asyncEnd(const char* category, const char* name, const void* id);
+
+    /**
+     * The recorded events as Chrome trace JSON
+     */
+    QByteArray toJson() const;
+
+    /**
+     * Writes toJson() to the given file and returns false on failure
+     */
+    bool writeJson(const QString& fileName) const;
+
+private:
+    explicit ETraceSink();
+    inline static ETraceSink* m_instance = nullptr;
+
+    struct Private;
+    Private* d;
+};
+
+namespace internal {
+/**
+ * Records a complete event spanning the lifetime of the object
+ */
+class ETraceScope {
+public:
+    ETraceScope(const char* category, const char* name) : m_category(category), m_name(name), m_start(-1) {
+        if (ETraceSink::instance().isEnabled()) {
+            m_start = ETraceSink::instance().now();
+        }
+    }
+
+    ~ETraceScope() {
+        if (m_start >= 0) {
+            ETraceSink::instance().completeEvent(m_category, m_name, m_start);
+        }
+    }
+
+private:
+    const char* m_category;
+    const char* m_name;
+    qint64 m_start;
+};
+}  // namespace internal
+}  // namespace ed
+
+#ifdef ED_DOCKMENU_TRACING
+#define ED_TRACE_CONCAT_IMPL(a, b) a##b
+#define ED_TRACE_CONCAT(a, b) ED_TRACE_CONCAT_IMPL(a, b)
+#define ED_TRACE_SCOPE(category, name) \
+    ed::internal::ETraceScope ED_TRACE_CONCAT(edTraceScope, __LINE__)(category, name)
+#define ED_TRACE_INSTANT(category, name) ed::ETraceSink::instance().instantEvent(category, name)
+#define ED_TRACE_ASYNC_BEGIN(category, name, id) ed::ETraceSink::instance().asyncBegin(category, name, id)
+#define ED_TRACE_ASYNC_END(category, name, id) ed::ETraceSink::instance().asyncEnd(category, name, id)
+#else
+#define ED_TRACE_SCOPE(category, name)
+#define ED_TRACE_INSTANT(category, name)
+#define ED_TRACE_ASYNC_BEGIN(category, name, id)
+#define ED_TRACE_ASYNC_END(category, name, id)
+#endif
+
+#endif  // ED_DOCKMENU_TRACE_H
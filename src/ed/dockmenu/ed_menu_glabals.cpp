@@ -70,6 +70,10 @@ QPixmap createTransparentPixmap(const QPixmap& Source, qreal Opacity) {
     return TransparentPixmap;
 }
 
+qint64 pixmapBytes(const QPixmap& pixmap) {
+    return qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+}
+
 void setButtonIcon(QAbstractButton* Button, QStyle::StandardPixmap StandarPixmap, ed::eIcon CustomIconId) {
     // First we try to use custom icons if available
     QIcon Icon = ed::EProvider::instance().customIcon(CustomIconId);
@@ -44,7 +44,8 @@
 #define ED_EXPORT
 #endif
 
-#define ED_DEBUG_PRINT
+// Define ED_DEBUG_PRINT to get qDebug() output, use the ED_TRACE_* macros from
+// Trace.h for everything that should end up in a release build
 #ifdef ED_DEBUG_PRINT
 #define ED_PRINT(s) qDebug() << s
 #else
@@ -104,6 +105,16 @@ enum eDragState {
     DraggingFloatingWidget  //!< DraggingFloatingWidget
 };
 
+/**
+ * How dragging a splitter handle resizes the adjacent widgets
+ */
+enum eSplitterResizeMode {
+    SplitterOpaqueResize,       //!< resize on every mouse move
+    SplitterGhostResize,        //!< draw a rubber band, resize once on release
+    SplitterRateLimitedResize,  //!< resize at most a fixed number of times per second
+};
+Q_ENUM_NS(eSplitterResizeMode);
+
 namespace internal {
 /**
  * Helper function for settings tooltips without cluttering the code with
@@ -142,6 +153,11 @@ QPixmap createPixmap(QWidget* wLeftTop, QWidget* wRightBottom, Qt::Orientation o
  */
 QPixmap createTransparentPixmap(const QPixmap& Source, qreal Opacity);
 
+/**
+ * Bytes of pixel data held by the given pixmap
+ */
+qint64 pixmapBytes(const QPixmap& pixmap);
+
 /**
  * Helper function to set the icon of a certain button.
  * Use this function to set the icons for the dock area and dock widget buttons.